@@ -0,0 +1,39 @@
+'''
+    Measure Buffer.write_chunks and Buffer.read_chunks over chunk sizes and counts.
+
+    The chunks are placed with a 4 byte gap, like a single attribute of an interleaved buffer.
+    Only the span covered by the chunks is mapped, common chunk sizes have dedicated copy loops
+    and copies above 8 MB are split between a few threads with the GIL released.
+'''
+
+import time
+
+import moderngl
+import numpy as np
+
+REPEAT = 20
+
+CHUNK_SIZES = [4, 8, 12, 16, 32, 64, 100]
+COUNTS = [10000, 100000, 1000000]
+
+ctx = moderngl.create_standalone_context()
+
+
+def bench(func, nbytes):
+    func()
+    start = time.perf_counter()
+    for _ in range(REPEAT):
+        func()
+    ctx.finish()
+    return REPEAT * nbytes / (time.perf_counter() - start) / 1e9
+
+
+for count in COUNTS:
+    for chunk_size in CHUNK_SIZES:
+        step = chunk_size + 4
+        data = np.random.randint(0, 256, chunk_size * count, dtype='u1').tobytes()
+        buf = ctx.buffer(reserve=step * count, dynamic=True)
+        write = bench(lambda: buf.write_chunks(data, 0, step, count), len(data))
+        read = bench(lambda: buf.read_chunks(chunk_size, 0, step, count), len(data))
+        print('%8d x %3d bytes  write_chunks: %6.2f GB/s  read_chunks: %6.2f GB/s' % (count, chunk_size, write, read))
+        buf.release()
@@ -0,0 +1,47 @@
+'''
+    Compare reading a buffer into numpy with Buffer.read and Buffer.map_array.
+
+    The read variant copies the buffer into bytes and wraps them with np.frombuffer.
+    The map_array variant maps the buffer and wraps the mapped memory
+    through __array__, the sum is computed in place.
+'''
+
+import time
+
+import moderngl
+import numpy as np
+
+REPEAT = 50
+
+SIZES = {
+    '4 MB': 1 << 20,
+    '64 MB': 1 << 24,
+}
+
+ctx = moderngl.create_standalone_context()
+
+
+def bench_read(buf, count):
+    start = time.perf_counter()
+    for _ in range(REPEAT):
+        np.frombuffer(buf.read(), 'f4').reshape(count // 4, 4).sum()
+    return REPEAT / (time.perf_counter() - start)
+
+
+def bench_map_array(buf, count):
+    start = time.perf_counter()
+    for _ in range(REPEAT):
+        with buf.map_array('f4', (count // 4, 4), access='r') as view:
+            array = np.asarray(view)
+            array.sum()
+            del array
+    return REPEAT / (time.perf_counter() - start)
+
+
+for name, count in SIZES.items():
+    buf = ctx.buffer(np.random.rand(count).astype('f4'))
+    bench_map_array(buf, count)
+    read_rate = bench_read(buf, count)
+    map_rate = bench_map_array(buf, count)
+    print('%-6s read: %7.1f/s  map_array: %7.1f/s  (x%.2f)' % (name, read_rate, map_rate, map_rate / read_rate))
+    buf.release()
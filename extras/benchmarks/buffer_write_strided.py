@@ -0,0 +1,47 @@
+'''
+    Compare uploading the columns of a structured array with Buffer.write.
+
+    The copy variant converts the strided column with memoryview.tobytes,
+    which goes through PyBuffer_ToContiguous like the previous write path.
+    The direct variant passes the column to Buffer.write,
+    the strided gather writes it straight into the mapped buffer.
+'''
+
+import time
+
+import moderngl
+import numpy as np
+
+REPEAT = 50
+
+VERTICES = 1000000
+
+ctx = moderngl.create_standalone_context()
+
+vertices = np.zeros(VERTICES, dtype=[('pos', 'f4', 3), ('normal', 'f4', 3), ('uv', 'f4', 2), ('id', 'u4')])
+vertices['pos'] = np.random.rand(VERTICES, 3)
+vertices['id'] = np.arange(VERTICES)
+
+COLUMNS = {
+    'id (u4)': vertices['id'],
+    'uv (2f)': vertices['uv'],
+    'pos (3f)': vertices['pos'],
+    'pos.x (f4)': vertices['pos'][:, 0],
+}
+
+
+def bench(buf, column, direct):
+    start = time.perf_counter()
+    for _ in range(REPEAT):
+        buf.write(column if direct else memoryview(column).tobytes())
+    ctx.finish()
+    return REPEAT * column.nbytes / (time.perf_counter() - start) / 1e9
+
+
+for name, column in COLUMNS.items():
+    buf = ctx.buffer(reserve=column.nbytes, dynamic=True)
+    bench(buf, column, True)
+    copy = bench(buf, column, False)
+    direct = bench(buf, column, True)
+    print('%-12s tobytes + write: %6.2f GB/s  write: %6.2f GB/s  (x%.2f)' % (name, copy, direct, direct / copy))
+    buf.release()
@@ -0,0 +1,86 @@
+'''
+    Compare frames per second of Framebuffer.read and Framebuffer.read_async.
+
+    Every frame renders a fullscreen triangle and reads the color attachment back.
+    The async variant collects the result of the previous frame,
+    so the transfer of frame N overlaps with rendering frame N + 1.
+'''
+
+import struct
+import time
+
+import moderngl
+
+FRAMES = 120
+
+RESOLUTIONS = {
+    '1080p': (1920, 1080),
+    '4K': (3840, 2160),
+}
+
+ctx = moderngl.create_standalone_context()
+
+prog = ctx.program(
+    vertex_shader='''
+        #version 330
+
+        in vec2 in_vert;
+        out vec2 v_uv;
+
+        void main() {
+            v_uv = in_vert;
+            gl_Position = vec4(in_vert * 2.0 - 1.0, 0.0, 1.0);
+        }
+    ''',
+    fragment_shader='''
+        #version 330
+
+        uniform float time;
+
+        in vec2 v_uv;
+        out vec4 f_color;
+
+        void main() {
+            f_color = vec4(fract(v_uv * 8.0 + time), sin(time), 1.0);
+        }
+    ''',
+)
+
+vbo = ctx.buffer(struct.pack('6f', 0.0, 0.0, 2.0, 0.0, 0.0, 2.0))
+vao = ctx.simple_vertex_array(prog, vbo, 'in_vert')
+
+
+def render(fbo, frame):
+    fbo.use()
+    prog['time'].value = frame / 60.0
+    vao.render()
+
+
+def bench_sync(fbo):
+    start = time.perf_counter()
+    for frame in range(FRAMES):
+        render(fbo, frame)
+        fbo.read(components=4)
+    return FRAMES / (time.perf_counter() - start)
+
+
+def bench_async(fbo):
+    start = time.perf_counter()
+    pending = None
+    for frame in range(FRAMES):
+        render(fbo, frame)
+        readback = fbo.read_async(components=4)
+        if pending is not None:
+            pending.result()
+        pending = readback
+    pending.result()
+    return FRAMES / (time.perf_counter() - start)
+
+
+for name, size in RESOLUTIONS.items():
+    fbo = ctx.simple_framebuffer(size, components=4)
+    bench_async(fbo)
+    sync_fps = bench_sync(fbo)
+    async_fps = bench_async(fbo)
+    print('%-6s read: %7.1f fps  read_async: %7.1f fps  (x%.2f)' % (name, sync_fps, async_fps, async_fps / sync_fps))
+    fbo.release()
@@ -0,0 +1,47 @@
+'''
+    Compare loading a scene where many meshes reference the same few textures.
+
+    The texture variant uploads every texture of every mesh,
+    the cache variant hashes the pixels and uploads each distinct texture once.
+'''
+
+import time
+
+import moderngl
+import numpy as np
+
+MESHES = 256
+DISTINCT = 8
+SIZE = (512, 512)
+
+ctx = moderngl.create_standalone_context()
+
+images = [np.random.randint(0, 255, SIZE + (4,), dtype='u1').tobytes() for _ in range(DISTINCT)]
+scene = [images[i % DISTINCT] for i in range(MESHES)]
+
+
+def bench_texture():
+    start = time.perf_counter()
+    textures = [ctx.texture(SIZE, 4, image) for image in scene]
+    ctx.finish()
+    elapsed = time.perf_counter() - start
+    for texture in textures:
+        texture.release()
+    return elapsed, MESHES * len(scene[0])
+
+
+def bench_cache():
+    cache = ctx.resource_cache()
+    start = time.perf_counter()
+    for image in scene:
+        cache.texture(SIZE, 4, image)
+    ctx.finish()
+    elapsed = time.perf_counter() - start
+    uploaded = cache.size
+    cache.clear()
+    return elapsed, uploaded
+
+
+for name, bench in [('texture', bench_texture), ('cache', bench_cache)]:
+    elapsed, uploaded = bench()
+    print('%-7s %6.1f ms  %5d MB uploaded' % (name, elapsed * 1000.0, uploaded >> 20))
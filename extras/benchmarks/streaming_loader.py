@@ -0,0 +1,66 @@
+'''
+    Compare the render thread time of streaming a memory mapped file into a buffer.
+
+    The write variant slices the np.memmap and calls Buffer.write per chunk,
+    page faults and copies happen on the render thread.
+    The loader variant requests the chunks from a StreamingLoader and only
+    calls update, the background threads read the file into the mapped buffer.
+    Each variant reads its own freshly written file.
+'''
+
+import os
+import tempfile
+import time
+
+import moderngl
+import numpy as np
+
+CHUNK = 1 << 22
+CHUNKS = 64
+
+ctx = moderngl.create_standalone_context()
+
+
+def make_file():
+    fd, path = tempfile.mkstemp()
+    with os.fdopen(fd, 'wb') as f:
+        for _ in range(CHUNKS):
+            f.write(np.random.rand(CHUNK // 4).astype('f4').tobytes())
+    return path
+
+
+def bench_write(path):
+    source = np.memmap(path, dtype='u1', mode='r')
+    buf = ctx.buffer(reserve=CHUNK * CHUNKS)
+    start = time.perf_counter()
+    for chunk in range(CHUNKS):
+        buf.write(source[chunk * CHUNK:(chunk + 1) * CHUNK], offset=chunk * CHUNK)
+    ctx.finish()
+    elapsed = time.perf_counter() - start
+    buf.release()
+    del source
+    return elapsed, elapsed
+
+
+def bench_loader(path):
+    source = np.memmap(path, dtype='u1', mode='r')
+    loader = ctx.streaming_loader(source, CHUNK, CHUNK * CHUNKS, threads=2)
+    render_thread = 0.0
+    start = time.perf_counter()
+    loader.request(range(CHUNKS))
+    while len(loader.resident) < CHUNKS:
+        frame = time.perf_counter()
+        loader.update()
+        render_thread += time.perf_counter() - frame
+        time.sleep(0.001)
+    elapsed = time.perf_counter() - start
+    loader.release()
+    del source
+    return elapsed, render_thread
+
+
+for name, bench in [('write', bench_write), ('loader', bench_loader)]:
+    path = make_file()
+    total, render_thread = bench(path)
+    os.remove(path)
+    print('%-6s total: %6.1f ms  render thread: %6.1f ms' % (name, total * 1000.0, render_thread * 1000.0))
@@ -0,0 +1,29 @@
+'''
+    Compare uploading a texture as RGBA8 pixels and as BC3 or BC1 blocks.
+
+    BC3 takes 16 bytes and BC1 8 bytes for every 4x4 block of 64 RGBA8 bytes,
+    the texture memory and the bytes copied per upload shrink by the same factor.
+'''
+
+import time
+
+import moderngl
+import numpy as np
+
+SIZE = 2048
+
+ctx = moderngl.create_standalone_context()
+
+for name, dtype, block_size in [('rgba8', 'f1', 64), ('bc3', 'bc3', 16), ('bc1', 'bc1', 8)]:
+    data = np.random.randint(0, 255, SIZE * SIZE // 16 * block_size, dtype='u1').tobytes()
+    texture = ctx.texture((SIZE, SIZE), 4, data, dtype=dtype)
+
+    texture.write(data)
+    ctx.finish()
+    start = time.perf_counter()
+    for _ in range(10):
+        texture.write(data)
+    ctx.finish()
+    print('%-5s %6.2f ms per upload of %5.2f MB' % (name, (time.perf_counter() - start) * 100.0, len(data) / 1e6))
+
+    texture.release()
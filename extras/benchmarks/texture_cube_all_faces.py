@@ -0,0 +1,44 @@
+'''
+    Compare uploading and reading back many small cube map probes.
+
+    The face variant calls TextureCube.write and TextureCube.read once per face,
+    the all variant calls TextureCube.write_all and TextureCube.read_all once per probe.
+'''
+
+import time
+
+import moderngl
+import numpy as np
+
+PROBES = 256
+SIZE = 16
+
+ctx = moderngl.create_standalone_context()
+textures = [ctx.texture_cube((SIZE, SIZE), 4, dtype='f2') for _ in range(PROBES)]
+faces = np.random.rand(6, SIZE, SIZE, 4).astype('f2')
+face_data = [faces[face].tobytes() for face in range(6)]
+all_data = faces.tobytes()
+
+
+def bench_face():
+    for texture in textures:
+        for face in range(6):
+            texture.write(face, face_data[face])
+        for face in range(6):
+            texture.read(face)
+
+
+def bench_all():
+    for texture in textures:
+        texture.write_all(all_data)
+        texture.read_all()
+
+
+for name, bench in [('face', bench_face), ('all', bench_all)]:
+    bench()
+    ctx.finish()
+    start = time.perf_counter()
+    for _ in range(10):
+        bench()
+    ctx.finish()
+    print('%-4s %6.2f ms per bake of %d probes' % (name, (time.perf_counter() - start) * 100.0, PROBES))
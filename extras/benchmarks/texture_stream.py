@@ -0,0 +1,58 @@
+'''
+    Compare the time to first image of loading a 512x512x512 volume from a file.
+
+    The write variant reads the whole file and uploads it with a single Texture3D.write,
+    the stream variant maps the file and uploads 16 slices per batch with Texture3D.stream.
+    The first image is ready when the first batch is uploaded.
+'''
+
+import os
+import tempfile
+import time
+
+import moderngl
+import numpy as np
+
+SIZE = 512
+
+ctx = moderngl.create_standalone_context()
+
+fd, path = tempfile.mkstemp()
+with os.fdopen(fd, 'wb') as f:
+    for _ in range(SIZE):
+        f.write(np.random.randint(0, 255, (SIZE, SIZE), dtype='u1').tobytes())
+
+
+def bench_write():
+    texture = ctx.texture3d((SIZE, SIZE, SIZE), 1)
+    start = time.perf_counter()
+    texture.write(np.fromfile(path, dtype='u1'))
+    ctx.finish()
+    elapsed = time.perf_counter() - start
+    texture.release()
+    return elapsed, elapsed
+
+
+def bench_stream():
+    texture = ctx.texture3d((SIZE, SIZE, SIZE), 1)
+    volume = np.memmap(path, dtype='u1', mode='r')
+    start = time.perf_counter()
+    stream = texture.stream(volume, 16)
+    while not stream.update():
+        time.sleep(0.0001)
+    ctx.finish()
+    first = time.perf_counter() - start
+    stream.update(wait=True)
+    ctx.finish()
+    elapsed = time.perf_counter() - start
+    stream.release()
+    texture.release()
+    del volume
+    return first, elapsed
+
+
+for name, bench in [('write', bench_write), ('stream', bench_stream)]:
+    first, total = bench()
+    print('%-6s first image: %7.1f ms  total: %7.1f ms' % (name, first * 1000.0, total * 1000.0))
+
+os.remove(path)
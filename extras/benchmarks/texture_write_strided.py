@@ -0,0 +1,38 @@
+'''
+    Compare updating 512x512 tiles of an 8192x8192 RGBA image held in a numpy array.
+
+    The copy variant makes every tile contiguous with np.ascontiguousarray before writing it,
+    the view variant writes the slice itself and lets GL_UNPACK_ROW_LENGTH skip the rest of the rows.
+'''
+
+import time
+
+import moderngl
+import numpy as np
+
+SIZE = 8192
+TILE = 512
+
+ctx = moderngl.create_standalone_context()
+image = np.random.randint(0, 255, (SIZE, SIZE, 4), dtype='u1')
+texture = ctx.texture((TILE, TILE), 4)
+tiles = [(y, x) for y in range(0, SIZE, TILE) for x in range(0, SIZE, TILE)]
+
+
+def bench_copy():
+    for y, x in tiles:
+        texture.write(np.ascontiguousarray(image[y:y + TILE, x:x + TILE]))
+
+
+def bench_view():
+    for y, x in tiles:
+        texture.write(image[y:y + TILE, x:x + TILE])
+
+
+for name, bench in [('copy', bench_copy), ('view', bench_view)]:
+    bench()
+    ctx.finish()
+    start = time.perf_counter()
+    bench()
+    ctx.finish()
+    print('%-4s %6.1f ms for %d tiles' % (name, (time.perf_counter() - start) * 1000.0, len(tiles)))
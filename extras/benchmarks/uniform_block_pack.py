@@ -0,0 +1,71 @@
+'''
+    Compare packing a 2 KB std140 material block with struct.pack and UniformBlock.pack.
+
+    The struct variant pads every vec3 and array element by hand like typical user code.
+'''
+
+import struct
+import timeit
+
+import moderngl
+import numpy as np
+
+ctx = moderngl.create_standalone_context()
+
+prog = ctx.program(
+    vertex_shader='''
+        #version 330
+
+        layout (std140) uniform Material {
+            vec4 base_color;
+            vec3 emissive;
+            float roughness;
+            mat4 uv_transform;
+            vec4 layers[32];
+            vec3 tints[64];
+        };
+
+        out vec4 color;
+
+        void main() {
+            color = base_color + vec4(emissive, roughness) + uv_transform[0] + layers[gl_VertexID] + vec4(tints[gl_VertexID], 0.0);
+        }
+    ''',
+    varyings=['color'],
+)
+
+block = prog['Material']
+ubo = ctx.buffer(reserve=block.size)
+out = bytearray(block.size)
+
+values = {
+    'base_color': (1.0, 0.5, 0.25, 1.0),
+    'emissive': (0.0, 0.1, 0.2),
+    'roughness': 0.5,
+    'uv_transform': np.eye(4, dtype='f4'),
+    'layers': np.random.rand(32, 4).astype('f4'),
+    'tints': np.random.rand(64, 3).astype('f4'),
+}
+
+
+def pack_struct():
+    data = struct.pack('4f3ff', *values['base_color'], *values['emissive'], values['roughness'])
+    data += values['uv_transform'].tobytes()
+    data += values['layers'].tobytes()
+    data += b''.join(struct.pack('3fx', *tint) + b'\0\0\0' for tint in values['tints'])
+    return data
+
+
+def bench(name, func, number=2000):
+    seconds = timeit.timeit(func, number=number) / number
+    print('%-28s %8.2f us' % (name, seconds * 1e6))
+    return seconds
+
+
+assert len(pack_struct()) == block.size
+
+a = bench('struct.pack + write', lambda: ubo.write(pack_struct()))
+b = bench('UniformBlock.pack bytes', lambda: ubo.write(block.pack(values)))
+c = bench('UniformBlock.pack out=buffer', lambda: block.pack(values, out=ubo))
+d = bench('UniformBlock.pack out=bytes', lambda: block.pack(values, out=out))
+print('speedup x%.2f' % (a / min(b, c, d)))
@@ -0,0 +1,82 @@
+'''
+    Compare draws per second of per-draw uniform uploads.
+
+    The buffer variant writes every block into its own small buffer and binds it
+    with Buffer.bind_to_uniform_block. The ring variant pushes every block into
+    a UniformRing and binds the range with render(..., uniform_block_offsets=).
+'''
+
+import struct
+import time
+
+import moderngl
+
+DRAWS = 10000
+
+ctx = moderngl.create_standalone_context()
+
+prog = ctx.program(
+    vertex_shader='''
+        #version 330
+
+        in vec2 in_vert;
+
+        layout (std140) uniform Draw {
+            vec4 offset;
+            vec4 color;
+        };
+
+        out vec4 v_color;
+
+        void main() {
+            gl_Position = vec4(in_vert * 0.01 + offset.xy, 0.0, 1.0);
+            v_color = color;
+        }
+    ''',
+    fragment_shader='''
+        #version 330
+
+        in vec4 v_color;
+        out vec4 f_color;
+
+        void main() {
+            f_color = v_color;
+        }
+    ''',
+)
+prog['Draw'].binding = 0
+
+vbo = ctx.buffer(struct.pack('6f', 0.0, 0.0, 1.0, 0.0, 0.0, 1.0))
+vao = ctx.simple_vertex_array(prog, vbo, 'in_vert')
+fbo = ctx.simple_framebuffer((512, 512))
+fbo.use()
+
+blocks = [struct.pack('8f', (i % 100) / 50.0 - 1.0, (i // 100) / 50.0 - 1.0, 0.0, 0.0, 1.0, 0.5, 0.25, 1.0) for i in range(DRAWS)]
+buffers = [ctx.buffer(reserve=32, dynamic=True) for i in range(DRAWS)]
+ring = ctx.uniform_ring(len(blocks) * 256 * 3)
+
+
+def bench_buffers():
+    start = time.perf_counter()
+    for block, buffer in zip(blocks, buffers):
+        buffer.write(block)
+        buffer.bind_to_uniform_block(0)
+        vao.render()
+    ctx.finish()
+    return DRAWS / (time.perf_counter() - start)
+
+
+def bench_ring():
+    start = time.perf_counter()
+    for block in blocks:
+        vao.render(uniform_block_offsets={0: ring.push(block)})
+    ring.advance()
+    ctx.finish()
+    return DRAWS / (time.perf_counter() - start)
+
+
+bench_buffers()
+bench_ring()
+buffers_dps = bench_buffers()
+ring_dps = bench_ring()
+print('buffers: %9.0f draws/s  uniform_ring: %9.0f draws/s  (x%.2f)' % (buffers_dps, ring_dps, ring_dps / buffers_dps))
@@ -11,20 +11,29 @@ if os.environ.get('READTHEDOCS') == 'True':
 
 from .error import *
 from .buffer import *
+from .buffer_arena import *
 from .compute_shader import *
 from .conditional_render import *
 from .context import *
+from .fence import *
 from .framebuffer import *
+from .mapped_array import *
 from .mock import *
 from .program import *
 from .program_members import *
 from .query import *
+from .readback import *
 from .renderbuffer import *
+from .resource_cache import *
 from .scope import *
+from .streaming_loader import *
 from .texture import *
 from .texture_3d import *
 from .texture_array import *
 from .texture_cube import *
+from .texture_stream import *
+from .texture_buffer import *
+from .uniform_ring import *
 from .vertex_array import *
 from .sampler import *
 
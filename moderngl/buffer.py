@@ -1,4 +1,81 @@
-__all__ = ['Buffer']
+from . import mgl
+from .mapped_array import MappedArray
+
+__all__ = ['Buffer', 'StreamBuffer', 'pack', 'encode_normals', 'quantize']
+
+
+def pack(fmt, *arrays) -> bytes:
+    '''
+        Interleave arrays using a buffer format.
+
+        Every array holds a single attribute of the format, padding does not take an array.
+        The bytes of a vertex must be contiguous in the arrays, the vertices may be strided.
+        Padding bytes are zero.
+
+        .. code-block:: python
+
+            data = moderngl.pack('3f 3f 2f', positions, normals, uvs)
+
+        Args:
+            fmt (str): The buffer format. See :ref:`buffer-format-label`.
+            arrays (list): The arrays, one for each attribute.
+
+        Returns:
+            bytes
+    '''
+
+    return mgl.pack(fmt, arrays)
+
+
+def encode_normals(data, components=3) -> bytes:
+    '''
+        Pack float32 unit vectors into the ``4n10`` buffer format.
+
+        Every vector takes 4 bytes instead of 12.
+        The components are clamped to [-1, 1], a missing w is zero.
+
+        .. code-block:: python
+
+            vbo = ctx.buffer(moderngl.encode_normals(normals))
+            vao = ctx.vertex_array(prog, [(vbo, '4n10', 'in_normal')])
+
+        Args:
+            data (bytes): The float32 vectors.
+            components (int): The number of components, 3 or 4.
+
+        Returns:
+            bytes
+    '''
+
+    return mgl.encode_normals(data, components)
+
+
+def quantize(data, components=3, dtype='n2') -> tuple:
+    '''
+        Quantize float32 positions to 16 or 8 bit signed normalized integers or to half floats.
+
+        The positions are mapped into [-1, 1] by their bounding box,
+        the shader recovers them with ``position * scale + offset``.
+        For half floats the values are kept as they are, the scale is one and the offset is zero.
+
+        .. code-block:: python
+
+            data, scale, offset = moderngl.quantize(positions)
+            vbo = ctx.buffer(data)
+            vao = ctx.vertex_array(prog, [(vbo, '3n2', 'in_vert')])
+            prog['scale'].value = scale
+            prog['offset'].value = offset
+
+        Args:
+            data (bytes): The float32 positions.
+            components (int): The number of components.
+            dtype (str): ``n2``, ``n1`` or ``f2``.
+
+        Returns:
+            tuple: The data, the scale and the offset.
+    '''
+
+    return mgl.quantize(data, components, dtype)
 
 
 class Buffer:
@@ -56,18 +133,54 @@ class Buffer:
 
         return self._glo
 
-    def write(self, data, *, offset=0) -> None:
+    def write(self, data, *, offset=0, src_dtype=None, dst_format=None) -> None:
         '''
             Write the content.
 
+            Strided data, for example a column of a numpy structured array,
+            is gathered directly into the mapped buffer without an intermediate copy.
+
+            With ``src_dtype`` and ``dst_format`` the data is converted while it is written,
+            floats are clamped to the range of integer destinations.
+
+            .. code-block:: python
+
+                buf.write(positions_f8, src_dtype='f8', dst_format='3f4')
+                buf.write(uvs_f4, src_dtype='f4', dst_format='2f2')
+
             Args:
                 data (bytes): The data.
 
+            Keyword Args:
+                offset (int): The offset.
+                src_dtype (str): The type of the data, for example ``'f8'`` or ``'i4'``.
+                dst_format (str): The buffer format to convert to. See :ref:`buffer-format-label`.
+        '''
+
+        self.mglo.write(data, offset, src_dtype, dst_format)
+
+    def write_interleaved(self, fmt, arrays, *, offset=0) -> None:
+        '''
+            Interleave arrays directly into the buffer.
+
+            The arrays are interleaved into the mapped buffer without an intermediate copy.
+            Padding bytes of the format are not written,
+            so a subset of the attributes can be updated in place.
+
+            .. code-block:: python
+
+                buf.write_interleaved('3f 3f 2f', [positions, normals, uvs])
+                buf.write_interleaved('3f 20x', [positions])
+
+            Args:
+                fmt (str): The buffer format. See :ref:`buffer-format-label`.
+                arrays (list): The arrays, one for each attribute.
+
             Keyword Args:
                 offset (int): The offset.
         '''
 
-        self.mglo.write(data, offset)
+        self.mglo.write_interleaved(fmt, tuple(arrays), offset)
 
     def write_chunks(self, data, start, step, count) -> None:
         '''
@@ -84,6 +197,24 @@ class Buffer:
 
         self.mglo.write_chunks(data, start, step, count)
 
+    def write_many(self, ranges) -> None:
+        '''
+            Write many disjoint ranges at once.
+
+            Every range is validated before anything is written.
+            The span covering the ranges is mapped once and only the written bytes are flushed,
+            which is much cheaper than calling :py:meth:`Buffer.write` for each range.
+
+            .. code-block:: python
+
+                buf.write_many([(0, b'abcd'), (64, b'efgh'), (256, b'ijkl')])
+
+            Args:
+                ranges (list): A list of (offset, data) tuples.
+        '''
+
+        self.mglo.write_many(ranges)
+
     def read(self, size=-1, *, offset=0) -> bytes:
         '''
             Read the content.
@@ -100,6 +231,80 @@ class Buffer:
 
         return self.mglo.read(size, offset)
 
+    def map(self, size=-1, *, offset=0, access='rw', invalidate=False, unsynchronized=False) -> memoryview:
+        '''
+            Map a range of the buffer without copying.
+
+            The returned memoryview points directly into the mapped buffer memory.
+            It can be wrapped by numpy with ``np.frombuffer`` without copying.
+            The buffer is unmapped when the memoryview is released,
+            use it as a context manager to release it at the end of the block.
+
+            .. code-block:: python
+
+                with buf.map(access='r') as mem:
+                    data = np.frombuffer(mem, dtype='f4').sum()
+
+            Args:
+                size (int): The size. Value ``-1`` means all.
+
+            Keyword Args:
+                offset (int): The offset.
+                access (str): ``'r'``, ``'w'`` or ``'rw'``.
+                invalidate (bool): Discard the previous content of the range.
+                unsynchronized (bool): Do not wait for pending GL commands using the buffer.
+
+            Returns:
+                memoryview
+        '''
+
+        return self.mglo.map(offset, size, access, invalidate, unsynchronized)
+
+    def map_array(self, dtype='f4', shape=None, *, offset=0, access='rw', invalidate=False, unsynchronized=False) -> 'MappedArray':
+        '''
+            Map a range of the buffer as a typed array without copying.
+
+            The result supports ``__array__`` and DLPack,
+            numpy and other array libraries wrap the mapped memory with its shape and dtype.
+
+            .. code-block:: python
+
+                with buf.map_array('f4', (1024, 4), access='r') as view:
+                    tensor = torch.from_dlpack(view)
+
+            Args:
+                dtype (str): Data type, the same types as textures.
+                shape (tuple): The shape. By default all the elements from the offset to the end of the buffer.
+
+            Keyword Args:
+                offset (int): The offset.
+                access (str): ``'r'``, ``'w'`` or ``'rw'``.
+                invalidate (bool): Discard the previous content of the range.
+                unsynchronized (bool): Do not wait for pending GL commands using the buffer.
+
+            Returns:
+                :py:class:`MappedArray` object
+        '''
+
+        typestr, itemsize = mgl.data_type(dtype)
+
+        if shape is None:
+            shape = ((self._size - offset) // itemsize,)
+
+        shape = tuple(shape)
+        size = itemsize
+        for dim in shape:
+            size *= dim
+
+        res = MappedArray.__new__(MappedArray)
+        res._memory = self.mglo.map(offset, size, access, invalidate, unsynchronized)
+        res._exports = []
+        res._dtype = dtype
+        res._shape = shape
+        res._typestr = typestr
+        res.extra = None
+        return res
+
     def read_into(self, buffer, size=-1, *, offset=0, write_offset=0) -> None:
         '''
             Read the content into a buffer.
@@ -152,7 +357,7 @@ class Buffer:
                 write_offset (int): The write offset.
         '''
 
-        return self.mglo.read(buffer, chunk_size, start, step, count, write_offset)
+        self.mglo.read_chunks_into(buffer, chunk_size, start, step, count, write_offset)
 
     def clear(self, size=-1, *, offset=0, chunk=None) -> None:
         '''
@@ -221,3 +426,75 @@ class Buffer:
         '''
 
         self.mglo.release()
+
+
+class StreamBuffer(Buffer):
+    '''
+        A stream buffer is a persistently mapped :py:class:`Buffer` split into regions.
+        Dynamic data is written directly into GPU visible memory without extra copies
+        and without the implicit synchronization of :py:meth:`Buffer.write`.
+
+        Each region is guarded by a fence. :py:meth:`StreamBuffer.allocate` hands out
+        memory from the current region, once the region is full or :py:meth:`StreamBuffer.advance`
+        is called the next region is used. The regions written since the last advance are fenced
+        by :py:meth:`StreamBuffer.advance`, allocating more than all regions in between raises an error.
+        Waiting only happens if the GPU is still reading the region that is about to be reused.
+
+        A StreamBuffer object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.stream_buffer` to create one.
+    '''
+
+    __slots__ = ['_regions', '_region_size']
+
+    def __init__(self):
+        self._regions = None
+        self._region_size = None
+        super().__init__()
+
+    def __repr__(self):
+        return '<StreamBuffer: %d>' % self.glo
+
+    @property
+    def regions(self) -> int:
+        '''
+            int: The number of regions.
+        '''
+
+        return self._regions
+
+    @property
+    def region_size(self) -> int:
+        '''
+            int: The size of a single region.
+        '''
+
+        return self._region_size
+
+    def allocate(self, size, *, alignment=1) -> tuple:
+        '''
+            Allocate memory from the current region.
+
+            The returned memoryview points into the mapped buffer and is only valid
+            until the region is reused, it must not be kept across frames.
+            The buffer cannot be released while the memoryview is alive.
+
+            Args:
+                size (int): The number of bytes.
+
+            Keyword Args:
+                alignment (int): The alignment of the returned offset.
+
+            Returns:
+                tuple: The offset in the buffer and a writable memoryview.
+        '''
+
+        return self.mglo.allocate(size, alignment)
+
+    def advance(self) -> None:
+        '''
+            Finish the current region and switch to the next one.
+
+            Call this once per frame after the draw calls using the allocations were issued.
+        '''
+
+        self.mglo.advance()
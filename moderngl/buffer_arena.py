@@ -0,0 +1,280 @@
+from .error import Error
+
+__all__ = ['BufferArena', 'BufferAllocation']
+
+
+class BufferAllocation:
+    '''
+        A range of a :py:class:`BufferArena`.
+
+        The allocation can be used in place of a :py:class:`Buffer`
+        as an attribute source in :py:meth:`Context.vertex_array`.
+
+        A BufferAllocation object cannot be instantiated directly.
+        Use :py:meth:`BufferArena.allocate` to create one.
+    '''
+
+    __slots__ = ['_arena', '_offset', '_size', '_alignment', 'extra']
+
+    def __init__(self):
+        self._arena = None
+        self._offset = None
+        self._size = None
+        self._alignment = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<BufferAllocation: %d bytes at %d>' % (self._size, self._offset)
+
+    @property
+    def arena(self) -> 'BufferArena':
+        '''
+            BufferArena: The arena the range belongs to.
+        '''
+
+        return self._arena
+
+    @property
+    def buffer(self) -> 'Buffer':
+        '''
+            Buffer: The buffer of the arena.
+        '''
+
+        return self._arena._buffer
+
+    @property
+    def offset(self) -> int:
+        '''
+            int: The offset of the range in the buffer.
+            It may change when the arena is compacted.
+        '''
+
+        return self._offset
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of the range.
+        '''
+
+        return self._size
+
+    def write(self, data, *, offset=0) -> None:
+        '''
+            Write the content.
+
+            Args:
+                data (bytes): The data.
+
+            Keyword Args:
+                offset (int): The offset relative to the start of the range.
+        '''
+
+        data = memoryview(data)
+
+        if offset < 0 or offset + data.nbytes > self._size:
+            raise Error('out of range offset = %d or size = %d' % (offset, data.nbytes))
+
+        self._arena._buffer.write(data, offset=self._offset + offset)
+
+    def read(self, size=-1, *, offset=0) -> bytes:
+        '''
+            Read the content.
+
+            Args:
+                size (int): The size. Value ``-1`` means all.
+
+            Keyword Args:
+                offset (int): The offset relative to the start of the range.
+
+            Returns:
+                bytes
+        '''
+
+        if size < 0:
+            size = self._size - offset
+
+        if offset < 0 or offset + size > self._size:
+            raise Error('out of range offset = %d or size = %d' % (offset, size))
+
+        return self._arena._buffer.read(size, offset=self._offset + offset)
+
+    def free(self) -> None:
+        '''
+            Return the range to the arena.
+        '''
+
+        self._arena.free(self)
+
+
+class BufferArena:
+    '''
+        A single large buffer that hands out ranges to many small meshes.
+
+        Every range shares one OpenGL buffer object, so creating thousands
+        of meshes does not create thousands of buffers and rendering them
+        does not rebind the array buffer between draws.
+
+        The storage is allocated once with ``glBufferStorage`` when available.
+        Freed ranges are merged with their free neighbours,
+        :py:meth:`BufferArena.compact` moves the used ranges to the front.
+
+        A BufferArena object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.buffer_arena` to create one.
+    '''
+
+    __slots__ = ['_buffer', '_free', '_allocations', 'ctx', 'extra']
+
+    def __init__(self):
+        self._buffer = None
+        self._free = None
+        self._allocations = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<BufferArena: %d bytes>' % self._buffer.size
+
+    @property
+    def buffer(self) -> 'Buffer':
+        '''
+            Buffer: The buffer holding every range.
+        '''
+
+        return self._buffer
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of the arena.
+        '''
+
+        return self._buffer.size
+
+    @property
+    def used(self) -> int:
+        '''
+            int: The number of bytes handed out, not counting alignment padding.
+        '''
+
+        return sum(allocation._size for allocation in self._allocations)
+
+    @property
+    def available(self) -> int:
+        '''
+            int: The number of free bytes, possibly split into several ranges.
+        '''
+
+        return sum(size for offset, size in self._free)
+
+    def allocate(self, size, *, alignment=16) -> BufferAllocation:
+        '''
+            Allocate a range of the arena.
+
+            The first free range the aligned allocation fits in is used.
+
+            Args:
+                size (int): The size of the range.
+
+            Keyword Args:
+                alignment (int): The alignment of the offset.
+
+            Returns:
+                :py:class:`BufferAllocation` object
+        '''
+
+        if size < 1 or alignment < 1:
+            raise Error('invalid size = %d or alignment = %d' % (size, alignment))
+
+        for index, (start, length) in enumerate(self._free):
+            offset = (start + alignment - 1) // alignment * alignment
+            if offset + size > start + length:
+                continue
+
+            remains = []
+            if offset > start:
+                remains.append((start, offset - start))
+            if offset + size < start + length:
+                remains.append((offset + size, start + length - offset - size))
+            self._free[index:index + 1] = remains
+
+            res = BufferAllocation.__new__(BufferAllocation)
+            res._arena = self
+            res._offset = offset
+            res._size = size
+            res._alignment = alignment
+            res.extra = None
+            self._allocations.add(res)
+            return res
+
+        raise Error('the arena cannot fit %d bytes' % size)
+
+    def free(self, allocation) -> None:
+        '''
+            Return a range to the arena.
+
+            Args:
+                allocation (BufferAllocation): The range allocated from this arena.
+        '''
+
+        if allocation not in self._allocations:
+            raise Error('the allocation does not belong to the arena')
+
+        self._allocations.remove(allocation)
+        self._insert_free(allocation._offset, allocation._size)
+
+    def compact(self) -> None:
+        '''
+            Move the used ranges to the start of the arena.
+
+            The content is moved on the GPU with ``glCopyBufferSubData``
+            and the offsets of the allocations are updated.
+            Vertex arrays created from the moved ranges must be created again.
+        '''
+
+        free = []
+        cursor = 0
+        for allocation in sorted(self._allocations, key=lambda x: x._offset):
+            offset = (cursor + allocation._alignment - 1) // allocation._alignment * allocation._alignment
+            if offset > cursor:
+                free.append((cursor, offset - cursor))
+            if allocation._offset > offset:
+                # Copy in steps no longer than the gap so source and destination never overlap.
+                step = allocation._offset - offset
+                for chunk in range(0, allocation._size, step):
+                    size = min(step, allocation._size - chunk)
+                    self.ctx.copy_buffer(self._buffer, self._buffer, size,
+                                         read_offset=allocation._offset + chunk, write_offset=offset + chunk)
+                allocation._offset = offset
+            cursor = allocation._offset + allocation._size
+
+        if cursor < self._buffer.size:
+            free.append((cursor, self._buffer.size - cursor))
+
+        self._free = free
+
+    def release(self) -> None:
+        '''
+            Release the buffer of the arena and every allocation.
+        '''
+
+        self._buffer.release()
+        self._allocations.clear()
+        self._free = []
+
+    def _insert_free(self, offset, size):
+        index = 0
+        while index < len(self._free) and self._free[index][0] < offset:
+            index += 1
+
+        if index < len(self._free) and offset + size == self._free[index][0]:
+            size += self._free.pop(index)[1]
+
+        if index > 0 and self._free[index - 1][0] + self._free[index - 1][1] == offset:
+            index -= 1
+            offset, size = self._free[index][0], self._free[index][1] + size
+            self._free.pop(index)
+
+        self._free.insert(index, (offset, size))
@@ -1,22 +1,33 @@
+import collections
+import mmap
 import os
+import queue
+import threading
 import warnings
 from typing import Dict, Tuple
 
 from . import mgl
-from .buffer import Buffer
+from .buffer import Buffer, StreamBuffer
+from .buffer_arena import BufferAllocation, BufferArena
 from .compute_shader import ComputeShader
 from .conditional_render import ConditionalRender
+from .error import Error
+from .fence import Fence
 from .framebuffer import Framebuffer
 from .program import Program, detect_format
 from .program_members import (Attribute, Subroutine, Uniform, UniformBlock,
                               Varying)
 from .query import Query
 from .renderbuffer import Renderbuffer
+from .resource_cache import ResourceCache
 from .scope import Scope
+from .streaming_loader import StreamingLoader
 from .texture import Texture
 from .texture_3d import Texture3D
 from .texture_array import TextureArray
+from .texture_buffer import TextureBuffer
 from .texture_cube import TextureCube
+from .uniform_ring import UniformRing
 from .vertex_array import VertexArray
 from .sampler import Sampler
 
@@ -59,12 +70,14 @@ class Context:
         ModernGL objects can be created from this class.
     '''
 
-    __slots__ = ['mglo', '_screen', '_info', 'version_code', 'fbo', 'extra']
+    __slots__ = ['mglo', '_screen', '_info', '_pack_buffers', '_staging', 'version_code', 'fbo', 'extra']
 
     def __init__(self):
         self.mglo = None
         self._screen = None
         self._info = None
+        self._pack_buffers = {}
+        self._staging = None
         self.version_code = None  #: int: The OpenGL version code. Reports ``410`` for OpenGL 4.1
         self.fbo = None  #: Framebuffer: The active framebuffer. Set every time ``Framebuffer.use()`` is called.
         self.extra = None  #: Any - Attribute for storing user defined objects
@@ -580,6 +593,183 @@ class Context:
         res.extra = None
         return res
 
+    def stream_buffer(self, size, *, regions=3) -> StreamBuffer:
+        '''
+            Create a :py:class:`StreamBuffer` object.
+
+            The buffer is allocated with ``glBufferStorage`` and persistently mapped,
+            it requires OpenGL 4.4 or ``GL_ARB_buffer_storage``.
+
+            Args:
+                size (int): The size of the buffer.
+
+            Keyword Args:
+                regions (int): The number of fenced regions, 3 for triple buffering.
+
+            Returns:
+                :py:class:`StreamBuffer` object
+        '''
+
+        if type(size) is str:
+            size = mgl.strsize(size)
+
+        res = StreamBuffer.__new__(StreamBuffer)
+        res.mglo, res._size, res._region_size, res._glo = self.mglo.stream_buffer(size, regions)
+        res._regions = regions
+        res._dynamic = True
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def buffer_arena(self, size) -> BufferArena:
+        '''
+            Create a :py:class:`BufferArena` object.
+
+            Args:
+                size (int): The size of the arena.
+
+            Returns:
+                :py:class:`BufferArena` object
+        '''
+
+        if type(size) is str:
+            size = mgl.strsize(size)
+
+        buffer = Buffer.__new__(Buffer)
+        buffer.mglo, buffer._size, buffer._glo = self.mglo.buffer_arena(size)
+        buffer._dynamic = True
+        buffer.ctx = self
+        buffer.extra = None
+
+        res = BufferArena.__new__(BufferArena)
+        res._buffer = buffer
+        res._free = [(0, buffer._size)]
+        res._allocations = set()
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def uniform_ring(self, size, *, regions=3) -> UniformRing:
+        '''
+            Create a :py:class:`UniformRing` object.
+
+            The ring is backed by a :py:class:`StreamBuffer`,
+            it requires OpenGL 4.4 or ``GL_ARB_buffer_storage``.
+
+            Args:
+                size (int): The size of the ring.
+
+            Keyword Args:
+                regions (int): The number of fenced regions, 3 for triple buffering.
+
+            Returns:
+                :py:class:`UniformRing` object
+        '''
+
+        res = UniformRing.__new__(UniformRing)
+        res._buffer = self.stream_buffer(size, regions=regions)
+        res._alignment = self.info['GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT']
+        res.ctx = self
+        res.extra = None
+        return res
+
+    def streaming_loader(self, source, chunk_size, budget, *, threads=2, read_ahead=0) -> StreamingLoader:
+        '''
+            Create a :py:class:`StreamingLoader` object.
+
+            The source is a file path or a contiguous buffer such as an ``np.memmap``.
+            Files are read with ``posix_fadvise(POSIX_FADV_SEQUENTIAL)``,
+            memory maps are advised with ``madvise(MADV_SEQUENTIAL)`` where available.
+            The chunk size should be a multiple of the vertex size so that every chunk can be drawn alone.
+
+            .. code-block:: python
+
+                loader = ctx.streaming_loader('points.bin', '16MB', '1GB', read_ahead=4)
+                vao = ctx.simple_vertex_array(prog, loader.buffer, 'in_vert')
+
+            Args:
+                source (str): The path of the file or a buffer.
+                chunk_size (int): The size of a chunk.
+                budget (int): The GPU memory for the resident chunks.
+
+            Keyword Args:
+                threads (int): The number of background threads.
+                read_ahead (int): The chunks following the last requested chunk to load when the budget allows.
+
+            Returns:
+                :py:class:`StreamingLoader` object
+        '''
+
+        if type(chunk_size) is str:
+            chunk_size = mgl.strsize(chunk_size)
+
+        if type(budget) is str:
+            budget = mgl.strsize(budget)
+
+        res = StreamingLoader.__new__(StreamingLoader)
+
+        if isinstance(source, (str, os.PathLike)):
+            res._path = os.fspath(source)
+            res._source = None
+            res._source_size = os.path.getsize(res._path)
+        else:
+            res._path = None
+            res._source = memoryview(source).cast('B')
+            res._source_size = res._source.nbytes
+
+            mapping = getattr(source, '_mmap', source)
+            if isinstance(mapping, mmap.mmap) and hasattr(mmap, 'MADV_SEQUENTIAL'):
+                mapping.madvise(mmap.MADV_SEQUENTIAL)
+
+        if chunk_size < 1 or budget < chunk_size or threads < 1 or not res._source_size:
+            raise Error('invalid chunk_size = %d, budget = %d or threads = %d for %d bytes' % (chunk_size, budget, threads, res._source_size))
+
+        res._chunk_size = chunk_size
+        res._slots = min(budget // chunk_size, res.chunks)
+        res._read_ahead = read_ahead
+        res._buffer = self.stream_buffer(res._slots * chunk_size, regions=1)
+        res._memory = memoryview(res._buffer.mglo)
+        res._wanted = []
+        res._resident = collections.OrderedDict()
+        res._loading = {}
+        res._free = list(reversed(range(res._slots)))
+        res._retired = []
+        res._jobs = queue.Queue()
+        res._done = queue.Queue()
+        res._workers = [threading.Thread(target=res._work, daemon=True) for _ in range(threads)]
+        res.ctx = self
+        res.extra = None
+
+        for worker in res._workers:
+            worker.start()
+
+        return res
+
+    def resource_cache(self) -> ResourceCache:
+        '''
+            Create a :py:class:`ResourceCache` object.
+
+            Identical uploads through the cache share a single buffer or texture.
+
+            .. code-block:: python
+
+                cache = ctx.resource_cache()
+                texture = cache.texture(image.size, 4, image.tobytes())
+
+            Returns:
+                :py:class:`ResourceCache` object
+        '''
+
+        res = ResourceCache.__new__(ResourceCache)
+        res._entries = {}
+        res._keys = {}
+        res._hits = 0
+        res._misses = 0
+        res._bytes_saved = 0
+        res.ctx = self
+        res.extra = None
+        return res
+
     def texture(self, size, components, data=None, *, samples=0, alignment=1, dtype='f1') -> 'Texture':
         '''
             Create a :py:class:`Texture` object.
@@ -592,7 +782,8 @@ class Context:
             Keyword Args:
                 samples (int): The number of samples. Value 0 means no multisample format.
                 alignment (int): The byte alignment 1, 2, 4 or 8.
-                dtype (str): Data type.
+                dtype (str): Data type. The compressed dtypes ``'bc1'`` to ``'bc7'``,
+                    ``'etc2'`` and ``'eac'`` take the data as 4x4 blocks.
 
             Returns:
                 :py:class:`Texture` object
@@ -621,7 +812,8 @@ class Context:
 
             Keyword Args:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
-                dtype (str): Data type.
+                dtype (str): Data type. The compressed dtypes ``'bc1'`` to ``'bc7'``,
+                    ``'etc2'`` and ``'eac'`` take the data as 4x4 blocks.
 
             Returns:
                 :py:class:`Texture3D` object
@@ -655,6 +847,9 @@ class Context:
 
         res = Texture3D.__new__(Texture3D)
         res.mglo, res._glo = self.mglo.texture3d(size, components, data, alignment, dtype)
+        res._size = size
+        res._components = components
+        res._dtype = dtype
         res.ctx = self
         res.extra = None
         return res
@@ -670,7 +865,8 @@ class Context:
 
             Keyword Args:
                 alignment (int): The byte alignment 1, 2, 4 or 8.
-                dtype (str): Data type.
+                dtype (str): Data type. The compressed dtypes ``'bc1'`` to ``'bc7'``,
+                    ``'etc2'`` and ``'eac'`` take the data as 4x4 blocks.
 
             Returns:
                 :py:class:`TextureCube` object
@@ -685,6 +881,37 @@ class Context:
         res.extra = None
         return res
 
+    def texture_buffer(self, buffer, format, *, offset=0, size=-1) -> 'TextureBuffer':
+        '''
+            Create a :py:class:`TextureBuffer` object.
+
+            The texture reads the content of the buffer, no data is copied.
+            Ranges other than the whole buffer require OpenGL 4.3 and an offset
+            aligned to ``GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT``.
+
+            Args:
+                buffer (Buffer): The buffer holding the texels.
+                format (str): A single buffer format node such as ``'4f'``, ``'1u4'`` or ``'4f1'``.
+                    See :ref:`buffer-format-label`.
+
+            Keyword Args:
+                offset (int): The offset of the first texel in the buffer.
+                size (int): The size of the range in bytes. Value ``-1`` means the rest of the buffer.
+
+            Returns:
+                :py:class:`TextureBuffer` object
+        '''
+
+        res = TextureBuffer.__new__(TextureBuffer)
+        res.mglo, res._size, res._offset, res._components, res._dtype, res._glo = self.mglo.texture_buffer(
+            buffer.mglo, format, offset, size
+        )
+        res._buffer = buffer
+        res._format = format
+        res.ctx = self
+        res.extra = None
+        return res
+
     def depth_texture(self, size, data=None, *, samples=0, alignment=4) -> 'Texture':
         '''
             Create a :py:class:`Texture` object.
@@ -717,9 +944,22 @@ class Context:
         '''
             Create a :py:class:`VertexArray` object.
 
+            The format can also be a numpy structured dtype or a structured array.
+            The offsets, the stride and the types are taken from the dtype and the fields are
+            matched to the attributes of the program by name, fields without an attribute are skipped.
+            Integer fields feeding float attributes are normalized, bool fields can only
+            feed integer attributes. With attribute names
+            only the listed fields are used.
+
+            .. code-block:: python
+
+                vbo = ctx.buffer(vertices)
+                vao = ctx.vertex_array(prog, [(vbo, vertices.dtype)])
+
             Args:
                 program (Program): The program used when rendering.
                 content (list): A list of (buffer, format, attributes). See :ref:`buffer-format-label`.
+                                The buffer can also be a :py:class:`BufferAllocation`.
                 index_buffer (Buffer): An index buffer.
 
             Keyword Args:
@@ -730,11 +970,23 @@ class Context:
                 :py:class:`VertexArray` object
         '''
         members = program._members
+
+        if any(type(b) is not str for _, b, *_ in content):
+            attributes = {name: member.mglo for name, member in members.items() if type(member) is Attribute}
+            derived = []
+            for a, b, *c in content:
+                if type(b) is not str:
+                    b, c = mgl.dtype_format(getattr(b, 'dtype', b), attributes, tuple(c) if c else None)
+                derived.append((a, b, *c))
+            content = derived
+
         index_buffer_mglo = None if index_buffer is None else index_buffer.mglo
-        content = tuple((a.mglo, b) + tuple(getattr(members.get(x), 'mglo', None) for x in c) for a, b, *c in content)
+        ranges = tuple((a._offset, a._size) if type(a) is BufferAllocation else (0, -1) for a, *_ in content)
+        content = tuple((a.buffer.mglo if type(a) is BufferAllocation else a.mglo, b) +
+                        tuple(getattr(members.get(x), 'mglo', None) for x in c) for a, b, *c in content)
 
         res = VertexArray.__new__(VertexArray)
-        res.mglo, res._glo = self.mglo.vertex_array(program.mglo, content, index_buffer_mglo,
+        res.mglo, res._glo = self.mglo.vertex_array(program.mglo, content, ranges, index_buffer_mglo,
                                                     index_element_size, skip_errors)
         res._program = program
         res._index_buffer = index_buffer
@@ -751,7 +1003,8 @@ class Context:
             Args:
                 program (Program): The program used when rendering.
                 buffer (Buffer): The buffer.
-                attributes (list): A list of attribute names.
+                attributes (list): A list of attribute names
+                                   or a single numpy structured dtype or array describing the buffer.
 
             Keyword Args:
                 index_element_size (int): byte size of each index element, 1, 2 or 4.
@@ -764,6 +1017,9 @@ class Context:
         if type(buffer) is list:
             raise SyntaxError('Change simple_vertex_array to vertex_array')
 
+        if len(attributes) == 1 and type(attributes[0]) is not str:
+            return self.vertex_array(program, [(buffer, attributes[0])], index_buffer, index_element_size)
+
         content = [(buffer, detect_format(program, attributes)) + attributes]
         return self.vertex_array(program, content, index_buffer, index_element_size)
 
@@ -828,6 +1084,23 @@ class Context:
         res.extra = None
         return res
 
+    def fence(self) -> 'Fence':
+        '''
+            Create a :py:class:`Fence` object.
+
+            The fence is inserted into the command stream right away,
+            it requires OpenGL 3.2 or ``GL_ARB_sync``.
+
+            Returns:
+                :py:class:`Fence` object
+        '''
+
+        res = Fence.__new__(Fence)
+        res.mglo = self.mglo.fence()
+        res.ctx = self
+        res.extra = None
+        return res
+
     def query(self, *, samples=False, any_samples=False, time=False, primitives=False) -> 'Query':
         '''
             Create a :py:class:`Query` object.
@@ -1095,6 +1368,47 @@ class Context:
 
         self.mglo.release()
 
+    def _pack_buffer(self, size) -> Buffer:
+        pool = self._pack_buffers.get(size)
+
+        if pool:
+            return pool.pop()
+
+        return self.buffer(reserve=size, dynamic=True)
+
+    def _recycle_pack_buffer(self, buffer) -> None:
+        # Only a few buffers of the most recently used sizes are kept,
+        # reads of ever changing sizes must not grow the pool without bounds.
+        pool = self._pack_buffers.pop(buffer.size, [])
+        self._pack_buffers[buffer.size] = pool
+
+        if len(pool) < 4:
+            pool.append(buffer)
+        else:
+            buffer.release()
+
+        while len(self._pack_buffers) > 4:
+            for old in self._pack_buffers.pop(next(iter(self._pack_buffers))):
+                old.release()
+
+    def _staging_buffer(self, data):
+        if self._staging is False:
+            return None
+
+        size = memoryview(data).nbytes
+
+        if self._staging is None or self._staging.region_size < size:
+            if self._staging is not None:
+                self._staging.release()
+
+            try:
+                self._staging = self.stream_buffer(max(1 << (size - 1).bit_length(), 0x1000000) * 3)
+            except Error:
+                self._staging = False
+                return None
+
+        return self._staging.mglo
+
 
 def create_context(require=None) -> Context:
     '''
@@ -1123,6 +1437,8 @@ def create_context(require=None) -> Context:
     ctx.fbo = ctx.detect_framebuffer()
     ctx.mglo.fbo = ctx.fbo.mglo
     ctx._info = None
+    ctx._pack_buffers = {}
+    ctx._staging = None
     ctx.extra = None
 
     if require is not None and ctx.version_code < require:
@@ -1144,8 +1460,18 @@ def create_standalone_context(require=None, **settings) -> 'Context':
             # Require at least OpenGL 4.3
             ctx = moderngl.create_context(require=430)
 
+            # Headless context on Linux without an X server
+            ctx = moderngl.create_standalone_context(backend='egl')
+
         Keyword Arguments:
             require (int): OpenGL version code.
+            backend (str): ``'glx'`` (default) or ``'egl'`` on Linux.
+                The ``egl`` backend needs no display server, it renders into a 1x1 pbuffer by default.
+                Without this argument the ``MODERNGL_BACKEND`` environment variable selects it.
+                Other platforms raise an :py:class:`Error` for ``'egl'``.
+            device_index (int): The ``EGL_EXT_platform_device`` device to render on,
+                for the ``egl`` backend only. By default the surfaceless Mesa display is tried
+                first, then the first device.
 
         Returns:
             :py:class:`Context` object
@@ -1153,13 +1479,15 @@ def create_standalone_context(require=None, **settings) -> 'Context':
 
     backend = os.environ.get('MODERNGL_BACKEND')
     if backend is not None:
-        settings['backend'] = backend
+        settings.setdefault('backend', backend)
 
     ctx = Context.__new__(Context)
     ctx.mglo, ctx.version_code = mgl.create_standalone_context(settings)
     ctx._screen = None
     ctx.fbo = None
     ctx._info = None
+    ctx._pack_buffers = {}
+    ctx._staging = None
     ctx.extra = None
 
     if require is not None and ctx.version_code < require:
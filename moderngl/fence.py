@@ -0,0 +1,55 @@
+__all__ = ['Fence']
+
+
+class Fence:
+    '''
+        A Fence object is signaled when all the commands issued before it was created are completed by the GPU.
+
+        Unlike :py:meth:`Context.finish`, which drains the entire pipeline, a fence can be polled or waited on
+        for a single point in the command stream. This makes it possible to reuse buffers and textures
+        in double or triple buffered pipelines without stalling.
+
+        A Fence object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.fence` to create one.
+    '''
+
+    __slots__ = ['mglo', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<Fence>'
+
+    @property
+    def signaled(self) -> bool:
+        '''
+            bool: True if the fence is signaled. This property never blocks.
+        '''
+
+        return self.mglo.signaled
+
+    def wait(self, timeout=-1) -> bool:
+        '''
+            Wait for the fence to be signaled.
+            Other python threads can run while waiting.
+
+            Args:
+                timeout (int): The timeout in nanoseconds.
+                    Negative values wait forever, zero only polls.
+
+            Returns:
+                bool: True if the fence is signaled, False if the timeout expired.
+        '''
+
+        return self.mglo.wait(timeout)
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object.
+        '''
+
+        self.mglo.release()
@@ -1,6 +1,8 @@
 from typing import Dict, Tuple, Union
 
+from . import mgl
 from .buffer import Buffer
+from .readback import Readback
 from .renderbuffer import Renderbuffer
 from .texture import Texture
 
@@ -212,6 +214,52 @@ class Framebuffer:
 
         return self.mglo.read_into(buffer, viewport, components, attachment, alignment, dtype, write_offset)
 
+    def read_async(self, viewport=None, components=3, *, attachment=0, alignment=1, dtype='f1') -> Readback:
+        '''
+            Read the content of the framebuffer without waiting for the GPU.
+
+            The pixels are read into a pixel pack buffer taken from a pool owned by the context.
+            Rendering the next frame can start while the previous one is transferred.
+
+            Args:
+                viewport (tuple): The viewport.
+                components (int): The number of components to read.
+
+            Keyword Args:
+                attachment (int): The color attachment.
+                alignment (int): The byte alignment of the pixels.
+                dtype (str): Data type.
+
+            Returns:
+                :py:class:`Readback` object
+        '''
+
+        if viewport is None:
+            width, height = self._size
+        else:
+            width, height = viewport[-2:]
+
+        if attachment == -1:
+            components = 1
+
+        typestr, itemsize = mgl.data_type(dtype)
+        row = width * components * itemsize
+        padded_row = (row + alignment - 1) // alignment * alignment
+        size = padded_row * height
+
+        res = Readback.__new__(Readback)
+        res._buffer = self.ctx._pack_buffer(size)
+        res._size = self.mglo.read_into(res._buffer.mglo, viewport, components, attachment, alignment, dtype, 0)
+        res._fence = self.ctx.fence()
+        res._data = None
+        res._dtype = dtype
+        res._shape = (height, width, components)
+        res._strides = (padded_row, components * itemsize, itemsize) if padded_row != row else None
+        res._typestr = typestr
+        res.ctx = self.ctx
+        res.extra = None
+        return res
+
     def release(self) -> None:
         '''
             Release the ModernGL object.
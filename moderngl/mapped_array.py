@@ -0,0 +1,99 @@
+import weakref
+
+from . import mgl
+
+__all__ = ['MappedArray']
+
+
+class MappedArray:
+    '''
+        A typed and shaped view of a mapped :py:class:`Buffer` range.
+
+        The array exports the mapped memory through ``__array__`` and DLPack.
+        ``np.asarray(view)`` and ``torch.from_dlpack(view)`` return arrays sharing
+        the memory of the buffer, nothing is copied.
+
+        The range stays mapped while an exported array or any array created from it is alive.
+        :py:meth:`MappedArray.release` unmaps the range and fails while exported arrays are alive.
+
+        A MappedArray object cannot be instantiated directly.
+        Use :py:meth:`Buffer.map_array` to create one.
+    '''
+
+    __slots__ = ['_memory', '_exports', '_dtype', '_shape', '_typestr', 'extra']
+
+    def __init__(self):
+        self._memory = None
+        self._exports = None
+        self._dtype = None
+        self._shape = None
+        self._typestr = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<MappedArray: %s %s>' % (self._dtype, self._shape)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.release()
+
+    @property
+    def memory(self) -> memoryview:
+        '''
+            memoryview: The mapped memory.
+        '''
+
+        return self._memory
+
+    @property
+    def dtype(self) -> str:
+        '''
+            str: The data type of the elements.
+        '''
+
+        return self._dtype
+
+    @property
+    def shape(self) -> tuple:
+        '''
+            tuple: The shape of the array.
+        '''
+
+        return self._shape
+
+    def __array__(self, dtype=None, copy=None):
+        # numpy is only imported when numpy asks for the array.
+        import numpy as np
+
+        array = np.frombuffer(self._memory, self._typestr)
+
+        # The memoryview created by numpy is referenced by every array derived from this one.
+        self._exports.append(weakref.ref(array.base))
+        array = array.reshape(self._shape)
+
+        if dtype is not None or copy:
+            array = array.astype(dtype or array.dtype, copy=True)
+
+        return array
+
+    def __dlpack__(self, *, stream=None, max_version=None, dl_device=None, copy=None):
+        if copy or dl_device not in (None, (1, 0)):
+            raise BufferError('only zero copy exports to the CPU are supported')
+
+        return mgl.dlpack(self._memory, self._dtype, self._shape, None, max_version is not None and max_version[0] >= 1)
+
+    def __dlpack_device__(self) -> tuple:
+        return (1, 0)
+
+    def release(self) -> None:
+        '''
+            Unmap the range.
+        '''
+
+        if any(export() is not None for export in self._exports):
+            raise BufferError('the mapped range is exported to arrays that are still alive')
+
+        self._memory.release()
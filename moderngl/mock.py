@@ -24,6 +24,55 @@ class Implementation:
 
         return 0
 
+    def pack(self, *args) -> bytes:
+        '''
+            pack
+        '''
+
+        return b''
+
+    def encode_normals(self, *args) -> bytes:
+        '''
+            encode_normals
+        '''
+
+        return b''
+
+    def quantize(self, *args) -> tuple:
+        '''
+            quantize
+        '''
+
+        return (b'', (), ())
+
+    def data_type(self, *args) -> tuple:
+        '''
+            data_type
+        '''
+
+        return ('|u1', 1)
+
+    def dlpack(self, *args) -> object:
+        '''
+            dlpack
+        '''
+
+        return None
+
+    def dtype_format(self, *args) -> tuple:
+        '''
+            dtype_format
+        '''
+
+        return ('', ())
+
+    def content_hash(self, *args) -> int:
+        '''
+            content_hash
+        '''
+
+        return 0
+
     def create_context(self, *args) -> 'Context':
         '''
             create_context
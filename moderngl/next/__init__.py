@@ -3,6 +3,7 @@ from .buffer import Buffer
 from .compute_shader import ComputeShader
 from .context import Context, create_context, extensions, hwinfo, inspect, glprocs, release
 from .error import Error
+from .fence import Fence
 from .framebuffer import Framebuffer
 from .limits import Limits
 from .program import Program
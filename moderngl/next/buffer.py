@@ -17,11 +17,11 @@ class Buffer:
 
     def read_into(self, buffer, size=-1, offset=0, write_offset=0) -> None:
         write_end = write_offset + (self.size if size < 0 else size)
-        memoryview(buffer)[write_offset:write_end] = self.__mglo.map(size, offset, True, False, None)
+        memoryview(buffer)[write_offset:write_end] = self.__mglo.map(size, offset, True, False, None, False, False)
         self.__mglo.unmap()
 
-    def map(self, size=-1, offset=0, readable=False, writable=False, dtype=None) -> None:
-        return self.__mglo.map(size, offset, readable, writable, dtype)
+    def map(self, size=-1, offset=0, readable=False, writable=False, dtype=None, invalidate=False, unsynchronized=False):
+        return self.__mglo.map(size, offset, readable, writable, dtype, invalidate, unsynchronized)
 
     def unmap(self) -> None:
         self.__mglo.unmap()
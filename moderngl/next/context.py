@@ -4,6 +4,7 @@ from typing import Any
 from . import mgl
 from .buffer import Buffer
 from .compute_shader import ComputeShader
+from .fence import Fence
 from .framebuffer import Framebuffer
 from .limits import Limits
 from .program import Program
@@ -76,6 +77,9 @@ class Context:
     def query(self, time=False, primitives=False, samples=False, any_samples=False) -> Query:
         return self.__mglo.query(time, primitives, samples, any_samples)
 
+    def fence(self) -> Fence:
+        return self.__mglo.fence()
+
     def renderbuffer(self, size, components=4, samples=0, dtype='f1') -> Renderbuffer:
         return self.__mglo.renderbuffer(size, components, samples, dtype)
 
@@ -117,8 +121,8 @@ class Context:
         self.fbo.viewport = value
 
 
-def create_context(standalone=False, debug=False, require=None, glhook=None, gc=None):
-    return mgl.create_context(standalone, debug, require, glhook, gc)
+def create_context(standalone=False, debug=False, require=None, glhook=None, gc=None, backend=None):
+    return mgl.create_context(standalone, debug, require, glhook, gc, backend)
 
 
 def extensions(context):
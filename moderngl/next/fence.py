@@ -0,0 +1,21 @@
+from typing import Any
+
+from . import mgl
+
+
+class Fence:
+    __slots__ = ['__mglo', 'extra']
+
+    def __init__(self):
+        self.__mglo = None  # type: Any
+        self.extra = None  # type: Any
+
+    @property
+    def signaled(self) -> bool:
+        return self.__mglo.signaled
+
+    def wait(self, timeout=-1) -> bool:
+        return self.__mglo.wait(timeout)
+
+    def release(self) -> None:
+        mgl.release(self)
@@ -5,6 +5,9 @@
 #include "internal/modules.hpp"
 #include "internal/tools.hpp"
 
+// Shared with the mgl extension, src is in the include path.
+#include "Gather.hpp"
+
 /* MGLBuffer_core_write(...)
  */
 int MGLBuffer_core_write(MGLBuffer * self, const Py_ssize_t & offset, Py_buffer * view, bool contiguous) {
@@ -19,7 +22,9 @@ int MGLBuffer_core_write(MGLBuffer * self, const Py_ssize_t & offset, Py_buffer
             PyErr_Format(moderngl_error, "cannot map the buffer");
             return -1;
         }
-        PyBuffer_ToContiguous(map, view, view->len, 'C');
+        if (!StridedGather((char *)map, view)) {
+            PyBuffer_ToContiguous(map, view, view->len, 'C');
+        }
         gl.UnmapBuffer(GL_ARRAY_BUFFER);
     }
 
@@ -192,7 +197,7 @@ PyObject * MGLBuffer_meth_write(MGLBuffer * self, PyObject * const * args, Py_ss
     }
 
     if (RANGE_ERROR(offset, view.len, self->size)) {
-        PyErr_Format(moderngl_error, "out of range offset = %d or size = %d", offset, view.len);
+        PyErr_Format(moderngl_error, "out of range offset = %zd or size = %zd", offset, view.len);
         return 0;
     }
 
@@ -233,7 +238,7 @@ PyObject * MGLBuffer_meth_read(MGLBuffer * self, PyObject * const * args, Py_ssi
     }
 
     if (RANGE_ERROR(offset, size, self->size)) {
-        PyErr_Format(moderngl_error, "out of range offset = %d or size = %d", offset, size);
+        PyErr_Format(moderngl_error, "out of range offset = %zd or size = %zd", offset, size);
         return 0;
     }
 
@@ -265,10 +270,10 @@ PyObject * MGLBuffer_meth_read(MGLBuffer * self, PyObject * const * args, Py_ssi
     return res;
 }
 
-/* MGLBuffer.map(size, offset, readable, writable, dtype)
+/* MGLBuffer.map(size, offset, readable, writable, dtype, invalidate, unsynchronized)
  */
 PyObject * MGLBuffer_meth_map(MGLBuffer * self, PyObject * const * args, Py_ssize_t nargs) {
-    if (nargs != 5) {
+    if (nargs != 7) {
         PyErr_Format(moderngl_error, "num args");
         return 0;
     }
@@ -278,6 +283,8 @@ PyObject * MGLBuffer_meth_map(MGLBuffer * self, PyObject * const * args, Py_ssiz
     int readable = PyObject_IsTrue(args[2]);
     int writable = PyObject_IsTrue(args[3]);
     PyObject * dtype = args[4];
+    int invalidate = PyObject_IsTrue(args[5]);
+    int unsynchronized = PyObject_IsTrue(args[6]);
 
     if (size < 0) {
         size = self->size - offset;
@@ -309,7 +316,12 @@ PyObject * MGLBuffer_meth_map(MGLBuffer * self, PyObject * const * args, Py_ssiz
     }
 
     if (RANGE_ERROR(offset, size, self->size)) {
-        PyErr_Format(moderngl_error, "out of range offset = %d or size = %d", offset, size);
+        PyErr_Format(moderngl_error, "out of range offset = %zd or size = %zd", offset, size);
+        return 0;
+    }
+
+    if ((invalidate || unsynchronized) && (readable || !writable)) {
+        PyErr_Format(moderngl_error, "invalidate and unsynchronized require write only access");
         return 0;
     }
 
@@ -322,6 +334,7 @@ PyObject * MGLBuffer_meth_map(MGLBuffer * self, PyObject * const * args, Py_ssiz
 
     self->context->bind_array_buffer(self->buffer_obj);
     unsigned flags = (readable ? GL_MAP_READ_BIT : 0) | (writable ? GL_MAP_WRITE_BIT : 0);
+    flags |= (invalidate ? GL_MAP_INVALIDATE_RANGE_BIT : 0) | (unsynchronized ? GL_MAP_UNSYNCHRONIZED_BIT : 0);
     void * map = gl.MapBufferRange(GL_ARRAY_BUFFER, offset, size, flags);
 
     if (!map) {
@@ -7,6 +7,7 @@
 #include "framebuffer.hpp"
 #include "limits.hpp"
 #include "program.hpp"
+#include "fence.hpp"
 #include "query.hpp"
 #include "renderbuffer.hpp"
 #include "sampler.hpp"
@@ -18,11 +19,11 @@
 #include "internal/tools.hpp"
 #include "internal/modules.hpp"
 
-/* moderngl.core.create_context(standalone, debug, require, glhook, gc)
+/* moderngl.core.create_context(standalone, debug, require, glhook, gc, backend)
  * Returns a Context object.
  */
 PyObject * meth_create_context(PyObject * self, PyObject * const * args, Py_ssize_t nargs) {
-    if (nargs != 5) {
+    if (nargs != 6) {
         PyErr_Format(moderngl_error, "num args");
         return 0;
     }
@@ -32,6 +33,25 @@ PyObject * meth_create_context(PyObject * self, PyObject * const * args, Py_ssiz
     PyObject * require = args[2];
     PyObject * glhook = args[3];
     PyObject * gc = args[4];
+    PyObject * backend = args[5];
+
+    bool egl = false;
+
+    if (backend != Py_None) {
+        const char * backend_name = PyUnicode_AsUTF8(backend);
+        if (!backend_name) {
+            return 0;
+        }
+        egl = !strcmp(backend_name, "egl");
+        if (!egl && strcmp(backend_name, "glx")) {
+            PyErr_Format(moderngl_error, "invalid backend: %s", backend_name);
+            return 0;
+        }
+#if defined(_WIN32) || defined(_WIN64) || defined(__APPLE__)
+        PyErr_Format(moderngl_error, "the %s backend is only supported on linux", backend_name);
+        return 0;
+#endif
+    }
 
     static bool first_run = true;
 
@@ -64,6 +84,7 @@ PyObject * meth_create_context(PyObject * self, PyObject * const * args, Py_ssiz
 
     context->glsl_compiler_error = moderngl_compiler_error;
     context->glsl_linker_error = moderngl_linker_error;
+    context->gl_context.egl = egl;
 
     if (!context->gl_context.load(standalone)) {
         return 0;
@@ -121,6 +142,7 @@ PyObject * meth_create_context(PyObject * self, PyObject * const * args, Py_ssiz
 
     context->MGLBuffer_class = (PyTypeObject *)PyType_FromSpec(&MGLBuffer_spec);
     context->MGLComputeShader_class = (PyTypeObject *)PyType_FromSpec(&MGLComputeShader_spec);
+    context->MGLFence_class = (PyTypeObject *)PyType_FromSpec(&MGLFence_spec);
     context->MGLFramebuffer_class = (PyTypeObject *)PyType_FromSpec(&MGLFramebuffer_spec);
     context->MGLProgram_class = (PyTypeObject *)PyType_FromSpec(&MGLProgram_spec);
     context->MGLQuery_class = (PyTypeObject *)PyType_FromSpec(&MGLQuery_spec);
@@ -346,6 +368,7 @@ MGLObject * _MGLObject_pop_mglo(PyObject * wrapper, int slot) {
 }
 
 void MGLContext_dealloc(MGLContext * self) {
+    free(self->sync_table.slots);
     Py_TYPE(self)->tp_free(self);
 }
 
@@ -358,6 +381,7 @@ PyMethodDef MGLContext_methods[] = {
     {"buffer", (PyCFunction)MGLContext_meth_buffer, METH_FASTCALL, 0},
     {"compute_shader", (PyCFunction)MGLContext_meth_compute_shader, METH_O, 0},
     {"configure", (PyCFunction)MGLContext_meth_configure, METH_O, 0},
+    {"fence", (PyCFunction)MGLContext_meth_fence, METH_NOARGS, 0},
     {"framebuffer", (PyCFunction)MGLContext_meth_framebuffer, METH_FASTCALL, 0},
     {"program", (PyCFunction)MGLContext_meth_program, METH_FASTCALL, 0},
     {"query", (PyCFunction)MGLContext_meth_query, METH_FASTCALL, 0},
@@ -419,6 +443,7 @@ PyMethodDef MGLContext_methods[] = {
     {"buffer", (PyCFunction)MGLContext_meth_buffer_va, METH_VARARGS, 0},
     {"compute_shader", (PyCFunction)MGLContext_meth_compute_shader, METH_O, 0},
     {"configure", (PyCFunction)MGLContext_meth_configure, METH_O, 0},
+    {"fence", (PyCFunction)MGLContext_meth_fence, METH_NOARGS, 0},
     {"framebuffer", (PyCFunction)MGLContext_meth_framebuffer_va, METH_VARARGS, 0},
     {"program", (PyCFunction)MGLContext_meth_program_va, METH_VARARGS, 0},
     {"query", (PyCFunction)MGLContext_meth_query_va, METH_VARARGS, 0},
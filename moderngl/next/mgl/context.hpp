@@ -5,6 +5,7 @@
 
 #include "internal/opengl/gl_context.hpp"
 #include "internal/opengl/gl_methods.hpp"
+#include "internal/bytecode.hpp"
 
 enum MGLEnableFlag {
     MGL_NOTHING = 0,
@@ -38,12 +39,15 @@ struct MGLContext {
     MGLFramebuffer * bound_framebuffer;
     MGLFramebuffer * default_framebuffer;
 
+    MGLBytecode::SyncTable sync_table;
+
     MGLScope * default_scope;
     MGLScope * active_scope;
     MGLScope * bound_scope;
 
     PyTypeObject * MGLBuffer_class;
     PyTypeObject * MGLComputeShader_class;
+    PyTypeObject * MGLFence_class;
     PyTypeObject * MGLFramebuffer_class;
     PyTypeObject * MGLProgram_class;
     PyTypeObject * MGLQuery_class;
@@ -0,0 +1,141 @@
+#include "fence.hpp"
+#include "context.hpp"
+
+#include "internal/wrapper.hpp"
+
+#include "internal/bytecode.hpp"
+#include "internal/modules.hpp"
+#include "internal/tools.hpp"
+
+/* MGLContext.fence()
+ */
+PyObject * MGLContext_meth_fence(MGLContext * self) {
+    if (!self->gl.FenceSync) {
+        PyErr_Format(moderngl_error, "fences are not supported");
+        return 0;
+    }
+
+    MGLBytecode::SyncTable & table = self->sync_table;
+
+    int slot = 0;
+    while (slot < table.size && table.slots[slot].used) {
+        slot += 1;
+    }
+
+    if (slot == table.size) {
+        int size = table.size ? table.size * 2 : 16;
+        MGLBytecode::SyncSlot * slots = (MGLBytecode::SyncSlot *)realloc(table.slots, size * sizeof(MGLBytecode::SyncSlot));
+        if (!slots) {
+            return PyErr_NoMemory();
+        }
+        memset(slots + table.size, 0, (size - table.size) * sizeof(MGLBytecode::SyncSlot));
+        table.slots = slots;
+        table.size = size;
+    }
+
+    table.slots[slot].used = true;
+
+    MGLFence * fence = MGLContext_new_object(self, Fence);
+
+    // While recording the fence is only created when the bytecode is replayed.
+    // The bytecode refers to the slot of the fence, replays after the fence is released skip it.
+    fence->slot = slot;
+    MGLBytecode::fence_sync(self->gl, table, slot);
+
+    return NEW_REF(fence->wrapper);
+}
+
+/* Deletes the sync of the fence and frees its slot.
+ */
+void MGLFence_release_slot(MGLFence * self) {
+    MGLBytecode::SyncSlot & slot = self->context->sync_table.slots[self->slot];
+    if (slot.sync) {
+        self->context->gl.DeleteSync(slot.sync);
+    }
+    slot.sync = 0;
+    slot.used = false;
+    slot.generation += 1;
+    self->slot = -1;
+}
+
+/* MGLFence.wait(timeout)
+ */
+PyObject * MGLFence_meth_wait(MGLFence * self, PyObject * arg) {
+    long long timeout = PyLong_AsLongLong(arg);
+    if (PyErr_Occurred()) {
+        return 0;
+    }
+
+    GLsync sync = self->context->sync_table.slots[self->slot].sync;
+
+    if (!sync) {
+        Py_RETURN_FALSE;
+    }
+
+    const GLMethods & gl = self->context->gl;
+
+    GLenum status = gl.ClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+    if (status == GL_TIMEOUT_EXPIRED && timeout) {
+        Py_BEGIN_ALLOW_THREADS
+        if (timeout < 0) {
+            do {
+                status = gl.ClientWaitSync(sync, 0, 1000000000);
+            } while (status == GL_TIMEOUT_EXPIRED);
+        } else {
+            status = gl.ClientWaitSync(sync, 0, (GLuint64)timeout);
+        }
+        Py_END_ALLOW_THREADS
+    }
+
+    if (status == GL_WAIT_FAILED) {
+        PyErr_Format(moderngl_error, "cannot wait for the fence");
+        return 0;
+    }
+
+    return PyBool_FromLong(status != GL_TIMEOUT_EXPIRED);
+}
+
+PyObject * MGLFence_get_signaled(MGLFence * self) {
+    GLsync sync = self->context->sync_table.slots[self->slot].sync;
+
+    if (!sync) {
+        Py_RETURN_FALSE;
+    }
+
+    GLenum status = self->context->gl.ClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+    return PyBool_FromLong(status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED);
+}
+
+void MGLFence_dealloc(MGLFence * self) {
+    // Released fences have no slot left, otherwise the fence still holds its context.
+    if (self->slot >= 0) {
+        MGLFence_release_slot(self);
+    }
+    Py_TYPE(self)->tp_free(self);
+}
+
+PyMethodDef MGLFence_methods[] = {
+    {"wait", (PyCFunction)MGLFence_meth_wait, METH_O, 0},
+    {0},
+};
+
+PyGetSetDef MGLFence_getset[] = {
+    {"signaled", (getter)MGLFence_get_signaled, 0, 0, 0},
+    {0},
+};
+
+PyType_Slot MGLFence_slots[] = {
+    {Py_tp_methods, MGLFence_methods},
+    {Py_tp_getset, MGLFence_getset},
+    {Py_tp_dealloc, (void *)MGLFence_dealloc},
+    {0},
+};
+
+PyType_Spec MGLFence_spec = {
+    mgl_ext ".Fence",
+    sizeof(MGLFence),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    MGLFence_slots,
+};
@@ -0,0 +1,17 @@
+#pragma once
+#include "mgl.hpp"
+
+#include "internal/opengl/opengl.hpp"
+
+struct MGLContext;
+
+struct MGLFence {
+    PyObject_HEAD
+    PyObject * wrapper;
+    MGLContext * context;
+    int slot;
+};
+
+extern PyType_Spec MGLFence_spec;
+PyObject * MGLContext_meth_fence(MGLContext * self);
+void MGLFence_release_slot(MGLFence * self);
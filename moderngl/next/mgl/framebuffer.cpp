@@ -210,7 +210,7 @@ PyObject * MGLFramebuffer_meth_read(MGLFramebuffer * self, PyObject * const * ar
 
     bool read_depth = attachment == -1;
 
-    int expected_size = width * self->components * data_type->size;
+    Py_ssize_t expected_size = (Py_ssize_t)width * self->components * data_type->size;
     expected_size = (expected_size + alignment - 1) / alignment * alignment;
     expected_size = expected_size * height;
 
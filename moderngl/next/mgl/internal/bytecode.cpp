@@ -9,6 +9,7 @@ char * buffer;
 char * ptr;
 GLMethods rec;
 GLMethods gl;
+SyncTable * syncs;
 
 template <typename T>
 inline void write(const T & value) {
@@ -229,6 +230,12 @@ void GLAPI rec_glEndTransformFeedback() {
     write(OP_glEndTransformFeedback);
 }
 
+GLsync GLAPI rec_glFenceSync(GLenum condition, GLbitfield flags) {
+    // The sync object does not exist until replay, use fence_sync instead.
+    error = true;
+    return 0;
+}
+
 void GLAPI rec_glFlush() {
     write(OP_glFlush);
 }
@@ -985,6 +992,18 @@ void evaluate(int size) {
             case OP_glEndConditionalRender: gl.EndConditionalRender(); break;
             case OP_glEndQuery: gl.EndQuery(read<GLenum>()); break;
             case OP_glEndTransformFeedback: gl.EndTransformFeedback(); break;
+            case OP_glFenceSync: {
+                int slot = read<int>();
+                int generation = read<int>();
+                if (slot < syncs->size && syncs->slots[slot].used && syncs->slots[slot].generation == generation) {
+                    GLsync & sync = syncs->slots[slot].sync;
+                    if (sync) {
+                        gl.DeleteSync(sync);
+                    }
+                    sync = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+                }
+                break;
+            }
             case OP_glFlush: gl.Flush(); break;
             case OP_glPixelStorei: gl.PixelStorei(read<GLenum>(), read<GLint>()); break;
             case OP_glSamplerParameteri: gl.SamplerParameteri(read<GLuint>(), read<GLenum>(), read<GLint>()); break;
@@ -1040,6 +1059,23 @@ void evaluate(int size) {
     ptr = buffer;
 }
 
+void fence_sync(const GLMethods & methods, SyncTable & table, int slot) {
+    if (methods.FenceSync == rec.FenceSync) {
+        write(OP_glFenceSync);
+        write(slot);
+        write(table.slots[slot].generation);
+        return;
+    }
+
+    GLsync & sync = table.slots[slot].sync;
+
+    if (sync) {
+        methods.DeleteSync(sync);
+    }
+
+    sync = methods.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
 void init() {
     rec.ActiveTexture = rec_glActiveTexture;
     rec.BeginConditionalRender = rec_glBeginConditionalRender;
@@ -1070,6 +1106,7 @@ void init() {
     rec.EndConditionalRender = rec_glEndConditionalRender;
     rec.EndQuery = rec_glEndQuery;
     rec.EndTransformFeedback = rec_glEndTransformFeedback;
+    rec.FenceSync = rec_glFenceSync;
     rec.Flush = rec_glFlush;
     rec.PixelStorei = rec_glPixelStorei;
     rec.SamplerParameteri = rec_glSamplerParameteri;
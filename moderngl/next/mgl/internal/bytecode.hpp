@@ -34,6 +34,7 @@ enum Opcode {
     OP_glEndConditionalRender,
     OP_glEndQuery,
     OP_glEndTransformFeedback,
+    OP_glFenceSync,
     OP_glFlush,
     OP_glPixelStorei,
     OP_glSamplerParameteri,
@@ -83,13 +84,29 @@ enum UniformOpcode {
     OP_glUniformMatrix4x3fv,
 };
 
+/* Recorded fences refer to a slot of the sync table of the context, never to the fence itself.
+ * Releasing a fence frees its slot and bumps the generation, replays of older bytecode skip it.
+ */
+struct SyncSlot {
+    GLsync sync;
+    int generation;
+    bool used;
+};
+
+struct SyncTable {
+    SyncSlot * slots;
+    int size;
+};
+
 extern bool error;
 extern char * buffer;
 extern char * ptr;
 extern GLMethods rec;
 extern GLMethods gl;
+extern SyncTable * syncs;
 
 void evaluate(int size);
+void fence_sync(const GLMethods & gl, SyncTable & table, int slot);
 void init();
 
 }
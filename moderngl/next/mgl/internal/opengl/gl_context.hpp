@@ -8,6 +8,7 @@ struct GLContext {
     void * old_window;
     void * old_display;
     bool standalone;
+    bool egl;
 
     bool load(bool standalone);
     void enter();
@@ -15,9 +15,242 @@ int SilentXErrorHandler(Display * d, XErrorEvent * e) {
     return 0;
 }
 
+#include <dlfcn.h>
+
+#define EGL_DONT_CARE -1
+#define EGL_NONE 0x3038
+#define EGL_SURFACE_TYPE 0x3033
+#define EGL_PBUFFER_BIT 0x0001
+#define EGL_WIDTH 0x3057
+#define EGL_HEIGHT 0x3056
+#define EGL_DRAW 0x3059
+#define EGL_RENDERABLE_TYPE 0x3040
+#define EGL_OPENGL_API 0x30A2
+#define EGL_OPENGL_BIT 0x0008
+#define EGL_CONTEXT_MAJOR_VERSION 0x3098
+#define EGL_CONTEXT_MINOR_VERSION 0x30FB
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK 0x30FD
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT 0x0001
+#define EGL_PLATFORM_DEVICE_EXT 0x313F
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+
+typedef void * (* PROC_eglGetProcAddress)(const char * procname);
+typedef void * (* PROC_eglGetPlatformDisplayEXT)(int platform, void * native_display, const int * attrib_list);
+typedef unsigned (* PROC_eglQueryDevicesEXT)(int max_devices, void ** devices, int * num_devices);
+typedef unsigned (* PROC_eglInitialize)(void * dpy, int * major, int * minor);
+typedef unsigned (* PROC_eglBindAPI)(unsigned api);
+typedef unsigned (* PROC_eglChooseConfig)(void * dpy, const int * attrib_list, void ** configs, int config_size, int * num_config);
+typedef void * (* PROC_eglCreateContext)(void * dpy, void * config, void * share_context, const int * attrib_list);
+typedef unsigned (* PROC_eglDestroyContext)(void * dpy, void * ctx);
+typedef unsigned (* PROC_eglMakeCurrent)(void * dpy, void * draw, void * read, void * ctx);
+typedef void * (* PROC_eglGetCurrentContext)();
+typedef void * (* PROC_eglGetCurrentDisplay)();
+typedef void * (* PROC_eglGetCurrentSurface)(int readdraw);
+typedef void * (* PROC_eglCreatePbufferSurface)(void * dpy, void * config, const int * attrib_list);
+typedef unsigned (* PROC_eglDestroySurface)(void * dpy, void * surface);
+
+struct EGLMethods {
+    PROC_eglGetPlatformDisplayEXT GetPlatformDisplayEXT;
+    PROC_eglQueryDevicesEXT QueryDevicesEXT;
+    PROC_eglInitialize Initialize;
+    PROC_eglBindAPI BindAPI;
+    PROC_eglChooseConfig ChooseConfig;
+    PROC_eglCreateContext CreateContext;
+    PROC_eglDestroyContext DestroyContext;
+    PROC_eglMakeCurrent MakeCurrent;
+    PROC_eglGetCurrentContext GetCurrentContext;
+    PROC_eglGetCurrentDisplay GetCurrentDisplay;
+    PROC_eglGetCurrentSurface GetCurrentSurface;
+    PROC_eglCreatePbufferSurface CreatePbufferSurface;
+    PROC_eglDestroySurface DestroySurface;
+};
+
+/* load_egl()
+ * libEGL is loaded at runtime, GLX only systems do not need it.
+ */
+const EGLMethods * load_egl() {
+    static EGLMethods egl = {};
+    static bool loaded = false;
+
+    if (loaded) {
+        return egl.MakeCurrent ? &egl : 0;
+    }
+
+    loaded = true;
+
+    void * libegl = dlopen("libEGL.so.1", RTLD_LAZY);
+
+    if (!libegl) {
+        return 0;
+    }
+
+    PROC_eglGetProcAddress eglGetProcAddress = (PROC_eglGetProcAddress)dlsym(libegl, "eglGetProcAddress");
+
+    if (!eglGetProcAddress) {
+        return 0;
+    }
+
+    egl.GetPlatformDisplayEXT = (PROC_eglGetPlatformDisplayEXT)eglGetProcAddress("eglGetPlatformDisplayEXT");
+    egl.QueryDevicesEXT = (PROC_eglQueryDevicesEXT)eglGetProcAddress("eglQueryDevicesEXT");
+    egl.Initialize = (PROC_eglInitialize)dlsym(libegl, "eglInitialize");
+    egl.BindAPI = (PROC_eglBindAPI)dlsym(libegl, "eglBindAPI");
+    egl.ChooseConfig = (PROC_eglChooseConfig)dlsym(libegl, "eglChooseConfig");
+    egl.CreateContext = (PROC_eglCreateContext)dlsym(libegl, "eglCreateContext");
+    egl.DestroyContext = (PROC_eglDestroyContext)dlsym(libegl, "eglDestroyContext");
+    egl.GetCurrentContext = (PROC_eglGetCurrentContext)dlsym(libegl, "eglGetCurrentContext");
+    egl.GetCurrentDisplay = (PROC_eglGetCurrentDisplay)dlsym(libegl, "eglGetCurrentDisplay");
+    egl.GetCurrentSurface = (PROC_eglGetCurrentSurface)dlsym(libegl, "eglGetCurrentSurface");
+    egl.CreatePbufferSurface = (PROC_eglCreatePbufferSurface)dlsym(libegl, "eglCreatePbufferSurface");
+    egl.DestroySurface = (PROC_eglDestroySurface)dlsym(libegl, "eglDestroySurface");
+    egl.MakeCurrent = (PROC_eglMakeCurrent)dlsym(libegl, "eglMakeCurrent");
+
+    if (!egl.GetPlatformDisplayEXT || !egl.Initialize || !egl.BindAPI || !egl.ChooseConfig || !egl.CreateContext || !egl.DestroyContext || !egl.GetCurrentContext || !egl.GetCurrentDisplay || !egl.GetCurrentSurface || !egl.CreatePbufferSurface || !egl.DestroySurface || !egl.MakeCurrent) {
+        egl.MakeCurrent = 0;
+        return 0;
+    }
+
+    return &egl;
+}
+
+/* open_egl_display()
+ * Mesa supports the surfaceless platform, other vendors expose their devices with EGL_EXT_platform_device.
+ */
+void * open_egl_display(const EGLMethods & egl) {
+    void * dpy = egl.GetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, 0, 0);
+
+    if (dpy && egl.Initialize(dpy, 0, 0)) {
+        return dpy;
+    }
+
+    void * devices[16] = {};
+    int num_devices = 0;
+
+    if (!egl.QueryDevicesEXT || !egl.QueryDevicesEXT(16, devices, &num_devices)) {
+        return 0;
+    }
+
+    for (int i = 0; i < num_devices; ++i) {
+        dpy = egl.GetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, devices[i], 0);
+
+        if (dpy && egl.Initialize(dpy, 0, 0)) {
+            return dpy;
+        }
+    }
+
+    return 0;
+}
+
+/* load_egl_context()
+ * Creates a context rendering into a 1x1 pbuffer, like the hidden window of the glx backend.
+ * The display is shared by every EGL context of the process, it is never terminated.
+ */
+bool load_egl_context(GLContext * self) {
+    const EGLMethods * egl = load_egl();
+
+    if (!egl) {
+        PyErr_Format(moderngl_error, "cannot load libEGL.so.1");
+        return false;
+    }
+
+    if (!self->standalone) {
+        self->display = egl->GetCurrentDisplay();
+        self->context = egl->GetCurrentContext();
+        self->window = egl->GetCurrentSurface(EGL_DRAW);
+
+        if (!self->context) {
+            PyErr_Format(moderngl_error, "cannot detect OpenGL context");
+            return false;
+        }
+
+        return true;
+    }
+
+    void * dpy = open_egl_display(*egl);
+
+    if (!dpy) {
+        PyErr_Format(moderngl_error, "cannot open a surfaceless or device EGL display");
+        return false;
+    }
+
+    if (!egl->BindAPI(EGL_OPENGL_API)) {
+        PyErr_Format(moderngl_error, "cannot bind the OpenGL API");
+        return false;
+    }
+
+    static int pbuffer_config_attribs[] = {
+        EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE,
+    };
+
+    static int config_attribs[] = {
+        EGL_SURFACE_TYPE, EGL_DONT_CARE,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_NONE,
+    };
+
+    void * config = 0;
+    int num_configs = 0;
+
+    bool pbuffer = egl->ChooseConfig(dpy, pbuffer_config_attribs, &config, 1, &num_configs) && num_configs;
+
+    if (!pbuffer && (!egl->ChooseConfig(dpy, config_attribs, &config, 1, &num_configs) || !num_configs)) {
+        PyErr_Format(moderngl_error, "cannot choose an EGL config");
+        return false;
+    }
+
+    void * ctx = 0;
+
+    for (int i = 0; i < versions; ++i) {
+        int attribs[] = {
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_CONTEXT_MAJOR_VERSION, version[i].major,
+            EGL_CONTEXT_MINOR_VERSION, version[i].minor,
+            EGL_NONE,
+        };
+
+        ctx = egl->CreateContext(dpy, config, 0, version[i].major ? attribs : 0);
+
+        if (ctx) {
+            break;
+        }
+    }
+
+    if (!ctx) {
+        PyErr_Format(moderngl_error, "cannot create OpenGL context");
+        return false;
+    }
+
+    static int pbuffer_attribs[] = {
+        EGL_WIDTH, 1,
+        EGL_HEIGHT, 1,
+        EGL_NONE,
+    };
+
+    void * surface = pbuffer ? egl->CreatePbufferSurface(dpy, config, pbuffer_attribs) : 0;
+
+    if (!egl->MakeCurrent(dpy, surface, surface, ctx)) {
+        if (surface) {
+            egl->DestroySurface(dpy, surface);
+        }
+        egl->DestroyContext(dpy, ctx);
+        PyErr_Format(moderngl_error, "cannot select OpenGL context");
+        return false;
+    }
+
+    self->display = dpy;
+    self->window = surface;
+    self->context = ctx;
+    return true;
+}
+
 bool GLContext::load(bool standalone) {
     this->standalone = standalone;
 
+    if (this->egl) {
+        return load_egl_context(this);
+    }
+
     if (standalone) {
         int width = 1;
         int height = 1;
@@ -156,6 +389,15 @@ bool GLContext::load(bool standalone) {
 }
 
 void GLContext::enter() {
+    if (this->egl) {
+        const EGLMethods * egl = load_egl();
+        this->old_display = egl->GetCurrentDisplay();
+        this->old_window = egl->GetCurrentSurface(EGL_DRAW);
+        this->old_context = egl->GetCurrentContext();
+        egl->MakeCurrent(this->display, this->window, this->window, this->context);
+        return;
+    }
+
     this->old_display = (void *)glXGetCurrentDisplay();
     this->old_window = (void *)glXGetCurrentDrawable();
     this->old_context = (void *)glXGetCurrentContext();
@@ -163,9 +405,18 @@ void GLContext::enter() {
 }
 
 void GLContext::exit() {
+    if (this->egl) {
+        load_egl()->MakeCurrent(this->old_display, this->old_window, this->old_window, this->old_context);
+        return;
+    }
+
     glXMakeCurrent((Display *)this->old_display, (Window)this->old_window, (GLXContext)this->old_context);
 }
 
 bool GLContext::active() {
+    if (this->egl) {
+        return this->context == load_egl()->GetCurrentContext();
+    }
+
     return this->context == glXGetCurrentContext();
 }
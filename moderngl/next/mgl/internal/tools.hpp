@@ -6,6 +6,12 @@ int prepare_buffer(PyObject * data, Py_buffer * view);
 bool unpack_viewport(PyObject * viewport, int & x, int & y, int & width, int & height);
 bool unpack_viewport(PyObject * viewport, int & x, int & y, int & z, int & width, int & height, int & depth);
 
+/* Draw calls take GLsizei counts, larger buffers are drawn up to the first 2^31 - 1 items.
+ */
+inline int clamp_count(Py_ssize_t count) {
+    return count < INT_MAX ? (int)count : INT_MAX;
+}
+
 inline PyObject * int_tuple(int i0, int i1) {
     PyObject * res = PyTuple_New(2);
     PyTuple_SET_ITEM(res, 0, PyLong_FromLong(i0));
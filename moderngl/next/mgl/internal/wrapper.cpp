@@ -30,6 +30,10 @@ int Context_class_fbo;
 int Context_class_recorder;
 int Context_class_extra;
 
+PyTypeObject * Fence_class;
+int Fence_class_mglo;
+int Fence_class_extra;
+
 PyTypeObject * Framebuffer_class;
 int Framebuffer_class_mglo;
 int Framebuffer_class_viewport;
@@ -261,6 +265,12 @@ void init_wrappers() {
     Context_class_extra = slot_offset(Context_class, "extra", Context_slots);
     assert_slots_len(Context_class, Context_slots);
 
+    int Fence_slots = 0;
+    Fence_class = detect_class(moderngl, "Fence", Fence_slots);
+    Fence_class_mglo = slot_offset(Fence_class, "_Fence__mglo", Fence_slots);
+    Fence_class_extra = slot_offset(Fence_class, "extra", Fence_slots);
+    assert_slots_len(Fence_class, Fence_slots);
+
     int Framebuffer_slots = 0;
     Framebuffer_class = detect_class(moderngl, "Framebuffer", Framebuffer_slots);
     Framebuffer_class_mglo = slot_offset(Framebuffer_class, "_Framebuffer__mglo", Framebuffer_slots);
@@ -29,6 +29,10 @@ extern int Context_class_fbo;
 extern int Context_class_recorder;
 extern int Context_class_extra;
 
+extern PyTypeObject * Fence_class;
+extern int Fence_class_mglo;
+extern int Fence_class_extra;
+
 extern PyTypeObject * Framebuffer_class;
 extern int Framebuffer_class_mglo;
 extern int Framebuffer_class_viewport;
@@ -5,6 +5,7 @@
 #include "context.hpp"
 #include "buffer.hpp"
 #include "recorder.hpp"
+#include "fence.hpp"
 #include "framebuffer.hpp"
 #include "limits.hpp"
 #include "program.hpp"
@@ -40,6 +41,12 @@ PyObject * meth_release(PyObject * self, PyObject * obj) {
         return MGLObject_release(buffer);
     }
 
+    if (obj->ob_type == Fence_class) {
+        MGLFence * fence = MGLObject_pop_mglo(Fence, obj);
+        MGLFence_release_slot(fence);
+        return MGLObject_release(fence);
+    }
+
     if (obj->ob_type == Framebuffer_class) {
         MGLFramebuffer * framebuffer = MGLObject_pop_mglo(Framebuffer, obj);
         const GLMethods & gl = framebuffer->context->gl;
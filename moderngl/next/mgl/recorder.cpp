@@ -16,6 +16,7 @@ PyObject * MGLContext_meth_replay(MGLContext * self, PyObject * bytecode) {
     }
 
     memcpy(&MGLBytecode::gl, &self->gl, sizeof(GLMethods));
+    MGLBytecode::syncs = &self->sync_table;
     MGLScope_begin_core(self->default_scope);
 
     Py_buffer view = {};
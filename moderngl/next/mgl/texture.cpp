@@ -9,6 +9,9 @@
 #include "internal/glsl.hpp"
 #include "internal/data_type.hpp"
 
+// Shared with the mgl extension, src is in the include path.
+#include "Gather.hpp"
+
 enum MGLTextureTypes {
     MGL_TEXTURE_2D,
     MGL_TEXTURE_3D,
@@ -152,8 +155,8 @@ PyObject * MGLContext_meth_texture(MGLContext * self, PyObject * const * args, P
         levels = max_levels;
     }
 
-    texture->expected_size = (texture->width * components * data_type->size + alignment - 1) & -alignment;
-    texture->expected_size *= texture->height * texture->depth;
+    texture->expected_size = ((Py_ssize_t)texture->width * components * data_type->size + alignment - 1) & -alignment;
+    texture->expected_size *= (Py_ssize_t)texture->height * texture->depth;
 
     texture->data_type = data_type;
     texture->components = components;
@@ -327,7 +330,7 @@ PyObject * MGLTexture_meth_write(MGLTexture * self, PyObject * const * args, Py_
         }
     }
 
-    int expected_size = width * self->components * self->data_type->size;
+    Py_ssize_t expected_size = (Py_ssize_t)width * self->components * self->data_type->size;
     expected_size = (expected_size + alignment - 1) / alignment * alignment;
     expected_size = expected_size * height * depth;
 
@@ -355,16 +358,37 @@ PyObject * MGLTexture_meth_write(MGLTexture * self, PyObject * const * args, Py_
         }
         void * buf = view.buf;
         bool contiguos = PyBuffer_IsContiguous(&view, 'C');
+        bool unpack_strides = false;
         if (!contiguos) {
-            buf = malloc(expected_size);
-            PyBuffer_ToContiguous(buf, &view, view.len, 'C');
+            Py_ssize_t pixel_size = self->components * self->data_type->size;
+            Py_ssize_t row_size = pixel_size * width;
+            if (view.len != row_size * height * depth) {
+                PyErr_Format(moderngl_error, "data size mismatch %zd != %zd", view.len, row_size * height * depth);
+                PyBuffer_Release(&view);
+                return 0;
+            }
+            // Views into a larger image are uploaded in place, the unpack parameters skip the rest of the rows.
+            Py_ssize_t row_stride, image_stride;
+            unpack_strides = PixelLayout(&view, row_size, height, depth, &row_stride, &image_stride);
+            unpack_strides = unpack_strides && row_stride % pixel_size == 0 && image_stride % row_stride == 0;
+            self->context->set_alignment(1);
+            if (unpack_strides) {
+                gl.PixelStorei(GL_UNPACK_ROW_LENGTH, (int)(row_stride / pixel_size));
+                gl.PixelStorei(GL_UNPACK_IMAGE_HEIGHT, (int)(image_stride / row_stride));
+            } else {
+                buf = malloc(view.len);
+                PixelGather((char *)buf, &view);
+            }
         }
         if (self->texture_target == GL_TEXTURE_3D) {
             gl.TexSubImage3D(self->texture_target, level, x, y, z, width, height, depth, format, pixel_type, buf);
         } else {
             gl.TexSubImage2D(self->texture_target, level, x, y, width, height, format, pixel_type, buf);
         }
-        if (!contiguos) {
+        if (unpack_strides) {
+            gl.PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+            gl.PixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+        } else if (!contiguos) {
             free(buf);
         }
         PyBuffer_Release(&view);
@@ -18,7 +18,7 @@ struct MGLTexture {
     int levels;
     int samples;
     int dimensions;
-    int expected_size;
+    Py_ssize_t expected_size;
 };
 
 extern PyType_Spec MGLTexture_spec;
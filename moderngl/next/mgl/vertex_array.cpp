@@ -6,6 +6,7 @@
 
 #include "internal/wrapper.hpp"
 #include "internal/modules.hpp"
+#include "internal/tools.hpp"
 
 /* MGLContext.vertex_array(program, content, index_buffer)
  */
@@ -81,7 +82,7 @@ PyObject * MGLContext_meth_vertex_array(MGLContext * self, PyObject * const * ar
         }
 
         if (!divisor) {
-            int cap = (int)(buffer->size / stride);
+            int cap = clamp_count(buffer->size / stride);
             vertices = vertices < cap ? vertices : cap;
         }
 
@@ -138,6 +139,14 @@ PyObject * MGLContext_meth_vertex_array(MGLContext * self, PyObject * const * ar
                         case 2: type = GL_HALF_FLOAT; break;
                         case 4: type = GL_FLOAT; break;
                         case 8: type = GL_DOUBLE; break;
+                        case 10: type = GL_UNSIGNED_INT_2_10_10_10_REV; break;
+                    }
+                    break;
+                case 'n':
+                    switch (bytes) {
+                        case 1: type = GL_BYTE; break;
+                        case 2: type = GL_SHORT; break;
+                        case 10: type = GL_INT_2_10_10_10_REV; break;
                     }
                     break;
                 case 'i':
@@ -162,10 +171,18 @@ PyObject * MGLContext_meth_vertex_array(MGLContext * self, PyObject * const * ar
 
             int locations = rows * size;
             int vsize = count / rows;
+            int node_size = bytes == 10 ? 4 : count * bytes;
+            bool normalize = shape == 'n' || (shape == 'f' && (bytes == 1 || bytes == 10));
+
+            if ((shape == 'n' || bytes == 10) && (rows != 1 || size != 1)) {
+                PyErr_Format(moderngl_error, "normalized formats cannot be used for matrix or array attributes");
+                return 0;
+            }
 
             for (int r = 0; r < locations; ++r) {
                 switch (shape) {
-                    case 'f': gl.VertexAttribPointer(location, vsize, type, shape == 'f' && bytes == 1, stride, ptr); break;
+                    case 'f': gl.VertexAttribPointer(location, vsize, type, normalize, stride, ptr); break;
+                    case 'n': gl.VertexAttribPointer(location, vsize, type, normalize, stride, ptr); break;
                     case 'i': gl.VertexAttribIPointer(location, vsize, type, stride, ptr); break;
                     case 'u': gl.VertexAttribIPointer(location, vsize, type, stride, ptr); break;
                     case 'd': gl.VertexAttribLPointer(location, vsize, type, stride, ptr); break;
@@ -173,7 +190,7 @@ PyObject * MGLContext_meth_vertex_array(MGLContext * self, PyObject * const * ar
 
                 gl.VertexAttribDivisor(location, divisor);
                 gl.EnableVertexAttribArray(location);
-                ptr += count * bytes / rows;
+                ptr += node_size / rows;
                 location += 1;
             }
         }
@@ -287,7 +304,7 @@ PyObject * MGLVertexArray_meth_render_indirect(MGLVertexArray * self, PyObject *
     MGLBuffer * index_buffer = SLOT(self->wrapper, MGLBuffer, VertexArray_class_ibo);
 
     if (count < 0) {
-        count = (int)((PyObject *)index_buffer != Py_None ? index_buffer->size / 4 : indirect_buffer->size / 20);
+        count = clamp_count((PyObject *)index_buffer != Py_None ? index_buffer->size / 4 : indirect_buffer->size / 20);
     }
 
     if (mode == Py_None) {
@@ -456,7 +473,7 @@ PyObject * MGLVertexArray_meth_transform_indirect(MGLVertexArray * self, PyObjec
     MGLBuffer * index_buffer = SLOT(self->wrapper, MGLBuffer, VertexArray_class_ibo);
 
     if (count < 0) {
-        count = (int)((PyObject *)index_buffer != Py_None ? index_buffer->size / 4 : indirect_buffer->size / 20);
+        count = clamp_count((PyObject *)index_buffer != Py_None ? index_buffer->size / 4 : indirect_buffer->size / 20);
     }
 
     if (mode == Py_None) {
@@ -545,7 +562,7 @@ int MGLVertexArray_set_ibo(MGLVertexArray * self, PyObject * value) {
         self->context->gl.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
     } else {
         MGLBuffer * ibo = SLOT(value, MGLBuffer, Buffer_class_mglo);
-        vertices_slot = PyLong_FromLong((int)(ibo->size / 4));
+        vertices_slot = PyLong_FromLong(clamp_count(ibo->size / 4));
         self->context->gl.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo->buffer_obj);
     }
 
@@ -32,11 +32,20 @@ def split_format(fmt):
         divisor = int(a) if a else 1 if not b else 0 if b == 'v' else 0x7fffffff
         nodes = nodes[:-1]
     for node in nodes:
-        match = re.match(r'^(\d*)([fiux])([1248]?)$', node)
+        match = re.match(r'^(\d*)(?:([fiux])([1248]?)|(n)([12])|([fn])(10))$', node)
         if not match:
             raise Error('%r is not a valid format node' % node)
-        a, b, c = match.groups()
+        a, b, c, d, e, f, g = match.groups()
         a = int(a) if a else 1
+        if f:
+            # 10_10_10_2 formats pack four components into a single 4 byte word.
+            if a != 4:
+                raise Error('%r is not a valid format node' % node)
+            res.append((a, f, 10))
+            stride += 4
+            continue
+        if d:
+            b, c = d, e
         c = int(c) if c else 1 if b == 'x' else 4
         res.append((a, b, c))
         stride += a * c
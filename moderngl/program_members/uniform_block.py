@@ -1,3 +1,5 @@
+from ..buffer import Buffer
+
 __all__ = ['UniformBlock']
 
 
@@ -54,3 +56,44 @@ class UniformBlock:
         '''
 
         return self._size
+
+    @property
+    def layout(self) -> dict:
+        '''
+            dict: The members of the uniform block as reported by the driver.
+
+            The values are ``(offset, array_length, array_stride, matrix_stride, columns, rows, kind, row_major)``
+            tuples where kind is one of ``'f'``, ``'d'``, ``'i'``, ``'u'`` or ``'b'``.
+        '''
+
+        return self.mglo.layout
+
+    def pack(self, values, *, out=None, offset=0) -> bytes:
+        '''
+            Pack the members of the uniform block using the offsets and strides of the program.
+
+            Works for any layout (std140, shared or packed) since the layout is queried from the driver.
+            Values can be numbers, nested sequences or objects supporting the buffer protocol
+            such as numpy arrays, they are converted to the type of the member.
+            Matrices are expected in column major order. Members not present in values are left untouched.
+
+            Args:
+                values (dict): The values by member name or a numpy structured array with matching field names.
+
+            Keyword Args:
+                out (Buffer): A Buffer or a writable bytes-like object to pack into.
+                    A :py:class:`StreamBuffer` is written through its persistent mapping.
+                offset (int): The offset of the block in out.
+
+            Returns:
+                bytes: The packed block when out is None.
+        '''
+
+        names = getattr(getattr(values, 'dtype', None), 'names', None)
+        if names:
+            values = {name: values[name] for name in names}
+
+        if isinstance(out, Buffer):
+            out = out.mglo
+
+        return self.mglo.pack(values, out, offset)
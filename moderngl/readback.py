@@ -0,0 +1,120 @@
+from . import mgl
+
+__all__ = ['Readback']
+
+
+class Readback:
+    '''
+        The pending result of an asynchronous read.
+
+        The pixels are transferred into a pooled pixel pack buffer on the GPU side.
+        The transfer completes in the background while new commands are issued.
+        Only :py:meth:`Readback.result` waits for it.
+
+        The result is a copy of the pixels in a bytes object, the pack buffer is not kept mapped.
+        It is exported with its shape and dtype through ``__array_interface__`` and DLPack,
+        ``np.asarray(readback)`` and ``torch.from_dlpack(readback)`` wait for the transfer
+        and wrap the bytes of the result without copying them again.
+
+        A Readback object cannot be instantiated directly.
+        Use :py:meth:`Framebuffer.read_async` to create one.
+    '''
+
+    __slots__ = ['_buffer', '_fence', '_size', '_data', '_dtype', '_shape', '_strides', '_typestr', 'ctx', 'extra']
+
+    def __init__(self):
+        self._buffer = None
+        self._fence = None
+        self._size = None
+        self._data = None
+        self._dtype = None
+        self._shape = None
+        self._strides = None
+        self._typestr = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<Readback: %d bytes>' % self._size
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of the result in bytes.
+        '''
+
+        return self._size
+
+    @property
+    def dtype(self) -> str:
+        '''
+            str: The data type of the components.
+        '''
+
+        return self._dtype
+
+    @property
+    def shape(self) -> tuple:
+        '''
+            tuple: The rows, the pixels in a row and the components of a pixel.
+        '''
+
+        return self._shape
+
+    @property
+    def strides(self) -> tuple:
+        '''
+            tuple: The strides in bytes or ``None`` when the rows are not padded.
+        '''
+
+        return self._strides
+
+    @property
+    def __array_interface__(self) -> dict:
+        return {
+            'version': 3,
+            'shape': self._shape,
+            'typestr': self._typestr,
+            'strides': self._strides,
+            'data': self.result(),
+        }
+
+    def __dlpack__(self, *, stream=None, max_version=None, dl_device=None, copy=None):
+        if copy or dl_device not in (None, (1, 0)):
+            raise BufferError('only zero copy exports to the CPU are supported')
+
+        return mgl.dlpack(self.result(), self._dtype, self._shape, self._strides, max_version is not None and max_version[0] >= 1)
+
+    def __dlpack_device__(self) -> tuple:
+        return (1, 0)
+
+    @property
+    def done(self) -> bool:
+        '''
+            bool: True if :py:meth:`Readback.result` would not block.
+        '''
+
+        return self._fence is None or self._fence.signaled
+
+    def result(self) -> bytes:
+        '''
+            Wait for the transfer and return a copy of the pixels.
+
+            The pixels are copied out of the pixel pack buffer once,
+            the buffer goes back to the pool of the context
+            and later calls return the same bytes.
+
+            Returns:
+                bytes
+        '''
+
+        if self._fence is not None:
+            self._fence.wait()
+            self._data = self._buffer.read(self._size)
+            self._fence.release()
+            self._fence = None
+            self.ctx._recycle_pack_buffer(self._buffer)
+            self._buffer = None
+
+        return self._data
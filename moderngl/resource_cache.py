@@ -0,0 +1,193 @@
+from . import mgl
+from .error import Error
+
+__all__ = ['ResourceCache', 'content_hash']
+
+
+def content_hash(data, seed=0) -> int:
+    '''
+        Compute the 64-bit XXH64 hash of the content.
+
+        The GIL is released while hashing, other threads keep running.
+
+        Args:
+            data (bytes): The data.
+            seed (int): The seed of the hash.
+
+        Returns:
+            int
+    '''
+
+    return mgl.content_hash(data, seed)
+
+
+class ResourceCache:
+    '''
+        Shares buffers and textures created from identical content.
+
+        Uploads are keyed by the XXH64 hash and size of the data and the format of the object.
+        Uploading the same content again returns the object created the first time
+        and counts a reference instead of allocating new GPU memory.
+
+        Cached objects are shared, they must be treated as immutable.
+        Writing them or changing their parameters affects every user.
+        Release them with :py:meth:`ResourceCache.release` instead of their own ``release`` method,
+        the GL object is deleted when the last reference is gone.
+
+        A ResourceCache object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.resource_cache` to create one.
+    '''
+
+    __slots__ = ['_entries', '_keys', '_hits', '_misses', '_bytes_saved', 'ctx', 'extra']
+
+    def __init__(self):
+        self._entries = None
+        self._keys = None
+        self._hits = None
+        self._misses = None
+        self._bytes_saved = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<ResourceCache: %d objects>' % len(self._entries)
+
+    @property
+    def hits(self) -> int:
+        '''
+            int: The number of uploads served from the cache.
+        '''
+
+        return self._hits
+
+    @property
+    def misses(self) -> int:
+        '''
+            int: The number of uploads that created a new object.
+        '''
+
+        return self._misses
+
+    @property
+    def bytes_saved(self) -> int:
+        '''
+            int: The bytes not uploaded thanks to cache hits.
+        '''
+
+        return self._bytes_saved
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The bytes held by the cached objects.
+        '''
+
+        return sum(entry[2] for entry in self._entries.values())
+
+    @property
+    def objects(self) -> int:
+        '''
+            int: The number of cached objects.
+        '''
+
+        return len(self._entries)
+
+    def buffer(self, data) -> 'Buffer':
+        '''
+            Get a buffer holding the data.
+
+            Args:
+                data (bytes): Content of the new buffer.
+
+            Returns:
+                :py:class:`Buffer` object
+        '''
+
+        data = memoryview(data)
+        key = ('buffer', data.nbytes, mgl.content_hash(data, 0))
+        return self._get(key, data.nbytes, lambda: self.ctx.buffer(data))
+
+    def texture(self, size, components, data, *, alignment=1, dtype='f1') -> 'Texture':
+        '''
+            Get a texture holding the data.
+
+            Args:
+                size (tuple): The width and height of the texture.
+                components (int): The number of components 1, 2, 3 or 4.
+                data (bytes): Content of the texture.
+
+            Keyword Args:
+                alignment (int): The byte alignment 1, 2, 4 or 8.
+                dtype (str): Data type.
+
+            Returns:
+                :py:class:`Texture` object
+        '''
+
+        data = memoryview(data)
+        key = ('texture', tuple(size), components, alignment, dtype, data.nbytes, mgl.content_hash(data, 0))
+        return self._get(key, data.nbytes, lambda: self.ctx.texture(size, components, data, alignment=alignment, dtype=dtype))
+
+    def references(self, obj) -> int:
+        '''
+            The number of references to a cached object.
+
+            Args:
+                obj: A buffer or texture returned by the cache.
+
+            Returns:
+                int: Zero if the object is not in the cache.
+        '''
+
+        key = self._keys.get(obj.mglo)
+        return 0 if key is None else self._entries[key][1]
+
+    def release(self, obj) -> None:
+        '''
+            Drop a reference to a cached object.
+
+            The object is released when its last reference is dropped.
+
+            Args:
+                obj: A buffer or texture returned by the cache.
+        '''
+
+        key = self._keys.get(obj.mglo)
+
+        if key is None:
+            raise Error('the object is not in the cache')
+
+        entry = self._entries[key]
+        entry[1] -= 1
+
+        if not entry[1]:
+            del self._entries[key]
+            del self._keys[obj.mglo]
+            entry[0].release()
+
+    def clear(self) -> None:
+        '''
+            Release every cached object regardless of its references.
+        '''
+
+        for obj, _, _ in self._entries.values():
+            obj.release()
+
+        self._entries.clear()
+        self._keys.clear()
+
+    def _get(self, key, nbytes, create):
+        entry = self._entries.get(key)
+
+        if entry is not None:
+            entry[1] += 1
+            self._hits += 1
+            self._bytes_saved += nbytes
+            return entry[0]
+
+        obj = create()
+        self._entries[key] = [obj, 1, nbytes]
+        self._keys[obj.mglo] = key
+        self._misses += 1
+        return obj
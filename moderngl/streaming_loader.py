@@ -0,0 +1,305 @@
+import os
+import queue
+
+from .error import Error
+
+__all__ = ['StreamingLoader']
+
+
+class StreamingLoader:
+    '''
+        Streams a dataset larger than the GPU memory budget into a :py:class:`StreamBuffer`.
+
+        The source is split into chunks. The buffer holds ``budget // chunk_size`` chunks,
+        each chunk occupies a slot of the buffer while it is resident.
+        Background threads read the requested chunks straight into the persistently mapped buffer
+        with ``readinto`` for files or a copy releasing the GIL for memory mapped arrays,
+        so page faults and copies happen off the render thread.
+
+        :py:meth:`StreamingLoader.update` runs on the render thread.
+        It publishes the chunks loaded since the last call and evicts the least recently
+        used chunks when the budget is full. Evicted slots are reused only after a fence
+        guarding the draws issued before the eviction is signaled.
+
+        A StreamingLoader object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.streaming_loader` to create one.
+    '''
+
+    __slots__ = [
+        '_buffer', '_memory', '_path', '_source', '_source_size', '_chunk_size', '_slots', '_read_ahead',
+        '_wanted', '_resident', '_loading', '_free', '_retired', '_jobs', '_done', '_workers', 'ctx', 'extra',
+    ]
+
+    def __init__(self):
+        self._buffer = None
+        self._memory = None
+        self._path = None
+        self._source = None
+        self._source_size = None
+        self._chunk_size = None
+        self._slots = None
+        self._read_ahead = None
+        self._wanted = None
+        self._resident = None
+        self._loading = None
+        self._free = None
+        self._retired = None
+        self._jobs = None
+        self._done = None
+        self._workers = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<StreamingLoader: %d of %d chunks>' % (len(self._resident), self.chunks)
+
+    @property
+    def buffer(self) -> 'StreamBuffer':
+        '''
+            StreamBuffer: The buffer holding the resident chunks.
+        '''
+
+        return self._buffer
+
+    @property
+    def source_size(self) -> int:
+        '''
+            int: The size of the source in bytes.
+        '''
+
+        return self._source_size
+
+    @property
+    def chunk_size(self) -> int:
+        '''
+            int: The size of a chunk, the last chunk may be shorter.
+        '''
+
+        return self._chunk_size
+
+    @property
+    def chunks(self) -> int:
+        '''
+            int: The number of chunks in the source.
+        '''
+
+        return (self._source_size + self._chunk_size - 1) // self._chunk_size
+
+    @property
+    def slots(self) -> int:
+        '''
+            int: The number of chunks the buffer can hold at once.
+        '''
+
+        return self._slots
+
+    @property
+    def resident(self) -> list:
+        '''
+            list: The (chunk, offset, size) of the resident chunks sorted by chunk.
+            The offset is the location of the chunk in the buffer.
+        '''
+
+        return [(chunk, slot * self._chunk_size, self._size(chunk)) for chunk, slot in sorted(self._resident.items())]
+
+    def locate(self, chunk) -> int:
+        '''
+            Find a resident chunk in the buffer.
+
+            Args:
+                chunk (int): The index of the chunk.
+
+            Returns:
+                int: The offset of the chunk in the buffer or ``None`` if it is not resident.
+        '''
+
+        slot = self._resident.get(chunk)
+        return None if slot is None else slot * self._chunk_size
+
+    def request(self, chunks) -> None:
+        '''
+            Set the chunks to keep resident, in priority order.
+
+            The chunks are loaded by the next :py:meth:`StreamingLoader.update` calls.
+            Resident chunks of the list are marked as recently used,
+            chunks missing from the list are evicted first when the budget is full.
+
+            Args:
+                chunks (list): The indices of the chunks.
+        '''
+
+        wanted = []
+        for chunk in chunks:
+            if chunk < 0 or chunk >= self.chunks:
+                raise Error('chunk = %d out of range' % chunk)
+            wanted.append(chunk)
+
+        if wanted and self._read_ahead:
+            last = wanted[-1]
+            wanted.extend(range(last + 1, min(last + 1 + self._read_ahead, self.chunks)))
+
+        self._wanted = list(dict.fromkeys(wanted))
+
+        for chunk in reversed(self._wanted):
+            if chunk in self._resident:
+                self._resident.move_to_end(chunk)
+
+    def update(self, *, wait=False) -> list:
+        '''
+            Publish the loaded chunks, evict and schedule new loads.
+
+            Call this once per frame before the draw calls using the resident chunks.
+
+            Keyword Args:
+                wait (bool): Block until every requested chunk fitting in the budget is resident.
+
+            Returns:
+                list: The chunks that became resident.
+        '''
+
+        loaded = self._collect(False)
+        self._schedule()
+
+        while wait and self._pending():
+            if self._loading:
+                loaded.extend(self._collect(True))
+            elif self._retired:
+                self._retired[0][0].wait()
+            else:
+                break
+
+            self._recycle()
+            self._schedule()
+
+        return sorted(loaded)
+
+    def release(self) -> None:
+        '''
+            Stop the background threads and release the buffer.
+        '''
+
+        if self._workers is None:
+            return
+
+        while True:
+            try:
+                self._jobs.get_nowait()
+            except queue.Empty:
+                break
+
+        for _ in self._workers:
+            self._jobs.put(None)
+
+        for worker in self._workers:
+            worker.join()
+
+        for fence, _ in self._retired:
+            fence.release()
+
+        self._workers = None
+        self._retired = []
+        self._memory.release()
+        self._buffer.release()
+
+    def _size(self, chunk):
+        return min(self._chunk_size, self._source_size - chunk * self._chunk_size)
+
+    def _pending(self):
+        return [chunk for chunk in self._wanted if chunk not in self._resident]
+
+    def _collect(self, block):
+        loaded = []
+        error = None
+
+        while True:
+            try:
+                chunk, slot, exception = self._done.get(block)
+            except queue.Empty:
+                break
+
+            block = False
+
+            del self._loading[chunk]
+
+            if exception is None:
+                self._resident[chunk] = slot
+                loaded.append(chunk)
+            else:
+                self._free.append(slot)
+                error = error or exception
+
+        if error is not None:
+            raise Error('cannot load chunk: %s' % error)
+
+        return loaded
+
+    def _recycle(self):
+        while self._retired and self._retired[0][0].signaled:
+            fence, slots = self._retired.pop(0)
+            self._free.extend(slots)
+            fence.release()
+
+    def _schedule(self):
+        self._recycle()
+
+        evicted = []
+        wanted = set(self._wanted)
+        victims = (chunk for chunk in list(self._resident) if chunk not in wanted)
+
+        for chunk in self._pending():
+            if chunk in self._loading:
+                continue
+
+            if not self._free:
+                victim = next(victims, None)
+                if victim is None:
+                    break
+                evicted.append(self._resident.pop(victim))
+                continue
+
+            slot = self._free.pop()
+            self._loading[chunk] = slot
+            self._jobs.put((chunk, slot))
+
+        if evicted:
+            self._retired.append((self.ctx.fence(), evicted))
+
+    def _work(self):
+        handle = None
+
+        if self._path is not None:
+            handle = open(self._path, 'rb', buffering=0)
+            if hasattr(os, 'posix_fadvise'):
+                os.posix_fadvise(handle.fileno(), 0, 0, os.POSIX_FADV_SEQUENTIAL)
+
+        try:
+            while True:
+                job = self._jobs.get()
+                if job is None:
+                    break
+
+                chunk, slot = job
+                start = chunk * self._chunk_size
+                size = self._size(chunk)
+                offset = slot * self._chunk_size
+                exception = None
+
+                try:
+                    if handle is not None:
+                        handle.seek(start)
+                        view = self._memory[offset:offset + size]
+                        while view:
+                            count = handle.readinto(view)
+                            if not count:
+                                raise EOFError('unexpected end of file')
+                            view = view[count:]
+                    else:
+                        self._buffer.mglo.load(offset, self._source[start:start + size])
+                except Exception as ex:
+                    exception = ex
+
+                self._done.put((chunk, slot, exception))
+        finally:
+            if handle is not None:
+                handle.close()
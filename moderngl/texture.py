@@ -1,6 +1,7 @@
 from typing import Tuple
 
 from .buffer import Buffer
+from .error import Error
 
 __all__ = ['Texture',
            'NEAREST', 'LINEAR', 'NEAREST_MIPMAP_NEAREST', 'LINEAR_MIPMAP_NEAREST', 'NEAREST_MIPMAP_LINEAR',
@@ -299,10 +300,17 @@ class Texture:
 
         return self.mglo.read_into(buffer, level, alignment, write_offset)
 
-    def write(self, data, viewport=None, *, level=0, alignment=1) -> None:
+    def write(self, data, viewport=None, *, level=0, alignment=1, async_=False, src_dtype=None) -> None:
         '''
             Update the content of the texture.
 
+            A strided view, such as a numpy slice of a larger image, is read in place.
+            Its strides are passed as ``GL_UNPACK_ROW_LENGTH`` and ``GL_UNPACK_IMAGE_HEIGHT``,
+            the alignment and ``async_`` do not apply to it.
+
+            Compressed textures take contiguous 4x4 blocks. Writing a whole level without
+            a viewport defines it, this uploads the mipmaps of a compressed texture.
+
             Args:
                 data (bytes): The pixel data.
                 viewport (tuple): The viewport.
@@ -310,12 +318,43 @@ class Texture:
             Keyword Args:
                 level (int): The mipmap level.
                 alignment (int): The byte alignment of the pixels.
+                async_ (bool): Copy the data into a staging buffer owned by the context
+                    and return without waiting for the driver to consume it.
+                src_dtype (str): The type of the data if it differs from the texture's dtype.
+                    The data is converted into a pixel unpack buffer owned by the context.
+                    It must hold tightly packed pixels, the alignment does not apply to it.
         '''
 
+        stage = None
+
+        if src_dtype is not None and src_dtype != self._dtype:
+            # The dtypes of block compressed textures such as 'bc1' have no pixel size.
+            if len(self._dtype) != 2:
+                raise Error('compressed textures cannot be written with src_dtype')
+
+            if type(data) is Buffer:
+                raise Error('src_dtype cannot be used with a Buffer')
+
+            if viewport is None:
+                width, height = max(self._size[0] >> level, 1), max(self._size[1] >> level, 1)
+            else:
+                width, height = viewport[-2:]
+
+            # The converted pixels are tightly packed, they are uploaded with an alignment of 1.
+            size = width * height * self._components * int(self._dtype[1:])
+            buffer = self.ctx._pack_buffer(size)
+            buffer.write(data, src_dtype=src_dtype, dst_format=self._dtype)
+            self.mglo.write(buffer.mglo, viewport, level, 1, None)
+            self.ctx._recycle_pack_buffer(buffer)
+            return
+
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(data, viewport, level, alignment)
+        elif async_:
+            stage = self.ctx._staging_buffer(data)
+
+        self.mglo.write(data, viewport, level, alignment, stage)
 
     def build_mipmaps(self, base=0, max_level=1000) -> None:
         '''
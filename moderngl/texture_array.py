@@ -1,6 +1,7 @@
 from typing import Tuple
 
 from .buffer import Buffer
+from .texture_stream import TextureStream, _texture_stream
 
 __all__ = ['TextureArray']
 
@@ -237,22 +238,61 @@ class TextureArray:
 
         return self.mglo.read_into(buffer, alignment, write_offset)
 
-    def write(self, data, viewport=None, *, alignment=1) -> None:
+    def write(self, data, viewport=None, *, alignment=1, async_=False) -> None:
         '''
             Update the content of the texture array.
 
+            A strided view, such as a numpy slice of a larger array, is read in place.
+            Its strides are passed as ``GL_UNPACK_ROW_LENGTH`` and ``GL_UNPACK_IMAGE_HEIGHT``,
+            the alignment and ``async_`` do not apply to it.
+
+            Compressed textures take contiguous 4x4 blocks.
+
             Args:
                 data (bytes): The pixel data.
                 viewport (tuple): The viewport.
 
             Keyword Args:
                 alignment (int): The byte alignment of the pixels.
+                async_ (bool): Copy the data into a staging buffer owned by the context
+                    and return without waiting for the driver to consume it.
         '''
 
+        stage = None
+
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(data, viewport, alignment)
+        elif async_:
+            stage = self.ctx._staging_buffer(data)
+
+        self.mglo.write(data, viewport, alignment, stage)
+
+    def stream(self, source, slices_per_batch, *, buffers=2) -> TextureStream:
+        '''
+            Load the texture array layer by layer on a background thread.
+
+            The source is a contiguous buffer such as an ``np.memmap`` holding every layer,
+            or a callable taking the ``first`` and ``last`` layer (exclusive) and returning their pixels.
+            Call :py:meth:`TextureStream.update` every frame to upload the batches read so far.
+
+            .. code-block:: python
+
+                volume = np.memmap('ct.raw', dtype='u2', mode='r')
+                stream = texture.stream(volume, 16)
+
+            Args:
+                source: The buffer or callable providing the pixels.
+                slices_per_batch (int): The number of layers read and uploaded at once.
+
+            Keyword Args:
+                buffers (int): The number of staging buffers.
+
+            Returns:
+                :py:class:`TextureStream` object
+        '''
+
+        return _texture_stream(self, source, slices_per_batch, buffers)
 
     def build_mipmaps(self, base=0, max_level=1000) -> None:
         '''
@@ -0,0 +1,140 @@
+from .error import Error
+
+__all__ = ['TextureBuffer']
+
+
+class TextureBuffer:
+    '''
+        A texture reading its texels from a range of a :py:class:`Buffer`.
+
+        Shaders access it through a ``samplerBuffer``, ``isamplerBuffer`` or ``usamplerBuffer``
+        uniform with ``texelFetch``. Large lookup tables are addressed with a single index
+        and writes to the buffer are visible without copying or repacking.
+        Texture buffers are not filtered, samplers bound to the same unit are ignored.
+
+        A TextureBuffer object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.texture_buffer` to create one.
+    '''
+
+    __slots__ = ['mglo', '_buffer', '_format', '_offset', '_size', '_components', '_dtype', '_glo', 'ctx', 'extra']
+
+    def __init__(self):
+        self.mglo = None
+        self._buffer = None
+        self._format = None
+        self._offset = None
+        self._size = None
+        self._components = None
+        self._dtype = None
+        self._glo = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<TextureBuffer: %d>' % self.glo
+
+    def __eq__(self, other):
+        return type(self) is type(other) and self.mglo is other.mglo
+
+    @property
+    def buffer(self) -> 'Buffer':
+        '''
+            Buffer: The buffer holding the texels.
+        '''
+
+        return self._buffer
+
+    @property
+    def format(self) -> str:
+        '''
+            str: The format of a texel.
+        '''
+
+        return self._format
+
+    @property
+    def offset(self) -> int:
+        '''
+            int: The offset of the first texel in the buffer.
+        '''
+
+        return self._offset
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of the range in bytes.
+        '''
+
+        return self._size
+
+    @property
+    def texels(self) -> int:
+        '''
+            int: The number of texels.
+        '''
+
+        return self._size // (self._components * int(self._dtype[1]))
+
+    @property
+    def components(self) -> int:
+        '''
+            int: The number of components of a texel.
+        '''
+
+        return self._components
+
+    @property
+    def dtype(self) -> str:
+        '''
+            str: The data type of the components as a texture dtype.
+        '''
+
+        return self._dtype
+
+    @property
+    def glo(self) -> int:
+        '''
+            int: The internal OpenGL object.
+            This values is provided for debug purposes only.
+        '''
+
+        return self._glo
+
+    def write(self, data, *, offset=0) -> None:
+        '''
+            Update texels in place by writing into the buffer.
+
+            Args:
+                data (bytes): The data.
+
+            Keyword Args:
+                offset (int): The offset in bytes relative to the start of the range.
+        '''
+
+        data = memoryview(data)
+
+        if offset < 0 or offset + data.nbytes > self._size:
+            raise Error('out of range offset = %d or size = %d' % (offset, data.nbytes))
+
+        self._buffer.write(data, offset=self._offset + offset)
+
+    def use(self, location=0) -> None:
+        '''
+            Bind the texture buffer.
+
+            Args:
+                location (int): The texture location.
+                    Same as the integer value that is used for samplerBuffer
+                    uniforms in the shaders.
+        '''
+
+        self.mglo.use(location)
+
+    def release(self) -> None:
+        '''
+            Release the ModernGL object.
+        '''
+
+        self.mglo.release()
@@ -167,10 +167,42 @@ class TextureCube:
 
         return self.mglo.read_into(buffer, face, alignment, write_offset)
 
-    def write(self, face, data, viewport=None, *, alignment=1) -> None:
+    def read_all(self, level=0, *, levels=1, alignment=1, out=None, write_offset=0) -> bytes:
+        '''
+            Read the six faces of one or more mipmap levels in a single call.
+
+            The faces follow each other in the order +X, -X, +Y, -Y, +Z, -Z,
+            the levels follow each other from the given level.
+            With OpenGL 4.5 every level is read with a single ``glGetTextureImage``.
+
+            Args:
+                level (int): The first mipmap level.
+
+            Keyword Args:
+                levels (int): The number of mipmap levels.
+                alignment (int): The byte alignment of the pixels.
+                out (bytearray): The buffer that will receive the pixels instead of a new bytes object.
+                write_offset (int): The write offset into ``out``.
+
+            Returns:
+                bytes: The pixels or ``None`` if ``out`` is given.
+        '''
+
+        if type(out) is Buffer:
+            out = out.mglo
+
+        return self.mglo.read_all(out, level, levels, alignment, write_offset)
+
+    def write(self, face, data, viewport=None, *, alignment=1, async_=False) -> None:
         '''
             Update the content of the texture.
 
+            A strided view, such as a numpy slice of a larger image, is read in place.
+            Its strides are passed as ``GL_UNPACK_ROW_LENGTH`` and ``GL_UNPACK_IMAGE_HEIGHT``,
+            the alignment and ``async_`` do not apply to it.
+
+            Compressed textures take contiguous 4x4 blocks.
+
             Args:
                 face (int): The face to update.
                 data (bytes): The pixel data.
@@ -178,12 +210,56 @@ class TextureCube:
 
             Keyword Args:
                 alignment (int): The byte alignment of the pixels.
+                async_ (bool): Copy the data into a staging buffer owned by the context
+                    and return without waiting for the driver to consume it.
         '''
 
+        stage = None
+
         if type(data) is Buffer:
             data = data.mglo
 
-        self.mglo.write(face, data, viewport, alignment)
+        elif async_:
+            stage = self.ctx._staging_buffer(data)
+
+        self.mglo.write(face, data, viewport, alignment, stage)
+
+    def write_all(self, data, level=0, *, levels=1, alignment=1) -> None:
+        '''
+            Update the six faces of one or more mipmap levels in a single call.
+
+            The data holds the faces in the order +X, -X, +Y, -Y, +Z, -Z,
+            followed by the faces of the next levels when ``levels`` is more than one.
+            With OpenGL 4.5 every level is uploaded with a single ``glTextureSubImage3D``.
+            Compressed levels are uploaded face by face, writing a level past the highest one
+            defines the mipmaps of a compressed cube map.
+
+            Args:
+                data (bytes): The pixel data.
+                level (int): The first mipmap level.
+
+            Keyword Args:
+                levels (int): The number of mipmap levels.
+                alignment (int): The byte alignment of the pixels.
+        '''
+
+        if type(data) is Buffer:
+            data = data.mglo
+
+        self.mglo.write_all(data, level, levels, alignment)
+
+    def build_mipmaps(self, base=0, max_level=1000) -> None:
+        '''
+            Generate mipmaps.
+
+            This also changes the texture filter to ``LINEAR_MIPMAP_LINEAR, LINEAR``
+
+            Keyword Args:
+                base (int): The base level
+                max_level (int): The maximum levels to generate
+        '''
+
+        self.mglo.build_mipmaps(base, max_level)
 
     def use(self, location=0) -> None:
         '''
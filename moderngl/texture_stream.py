@@ -0,0 +1,277 @@
+import mmap
+import queue
+import threading
+
+from .error import Error
+
+__all__ = ['TextureStream']
+
+
+class TextureStream:
+    '''
+        Streams the slices of a :py:class:`Texture3D` or :py:class:`TextureArray` from a source.
+
+        The slices are read in batches by a background thread straight into persistently
+        mapped pixel unpack buffers. :py:meth:`TextureStream.update` runs on the render thread,
+        it uploads the batches read since the last call with one ``glTexSubImage3D`` per batch
+        and hands the staging buffer back to the reader once a fence shows the upload is done.
+        With two or more staging buffers reading the next batch overlaps with uploading the previous one.
+
+        The texture is usable while it is loading, :py:attr:`TextureStream.valid` tells
+        which slices already hold their data. Only the staging buffers are held in host memory,
+        a callable source can produce the volume batch by batch.
+
+        A TextureStream object cannot be instantiated directly, it requires a texture.
+        Use :py:meth:`Texture3D.stream` or :py:meth:`TextureArray.stream` to create one.
+    '''
+
+    __slots__ = [
+        '_texture', '_source', '_slices', '_slice_size', '_batch', '_staging', '_next', '_valid',
+        '_reading', '_free', '_retired', '_jobs', '_done', '_worker', 'ctx', 'extra',
+    ]
+
+    def __init__(self):
+        self._texture = None
+        self._source = None
+        self._slices = None
+        self._slice_size = None
+        self._batch = None
+        self._staging = None
+        self._next = None
+        self._valid = None
+        self._reading = None
+        self._free = None
+        self._retired = None
+        self._jobs = None
+        self._done = None
+        self._worker = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<TextureStream: %d of %d slices>' % (self.loaded, self._slices)
+
+    @property
+    def texture(self):
+        '''
+            Texture3D or TextureArray: The texture being loaded.
+        '''
+
+        return self._texture
+
+    @property
+    def slices(self) -> int:
+        '''
+            int: The number of slices or layers of the texture.
+        '''
+
+        return self._slices
+
+    @property
+    def slices_per_batch(self) -> int:
+        '''
+            int: The number of slices read and uploaded at once.
+        '''
+
+        return self._batch
+
+    @property
+    def loaded(self) -> int:
+        '''
+            int: The number of slices uploaded.
+        '''
+
+        return self._valid.count(1)
+
+    @property
+    def progress(self) -> float:
+        '''
+            float: The uploaded fraction of the texture from 0.0 to 1.0.
+        '''
+
+        return self.loaded / self._slices
+
+    @property
+    def done(self) -> bool:
+        '''
+            bool: True if every slice is uploaded.
+        '''
+
+        return self.loaded == self._slices
+
+    @property
+    def valid(self) -> bytes:
+        '''
+            bytes: One byte per slice, 1 if the slice is uploaded and 0 otherwise.
+            It can be written into a texture to mask the missing slices in a shader.
+        '''
+
+        return bytes(self._valid)
+
+    def update(self, *, wait=False) -> list:
+        '''
+            Upload the batches read since the last call and schedule the next reads.
+
+            Call this once per frame before the draw calls sampling the texture.
+
+            Keyword Args:
+                wait (bool): Block until every slice is uploaded.
+
+            Returns:
+                list: The (first, count) ranges of the slices uploaded by this call.
+        '''
+
+        uploaded = self._collect(False)
+        self._schedule()
+
+        while wait and not self.done:
+            if self._reading:
+                uploaded.extend(self._collect(True))
+            elif self._retired:
+                self._retired[0][0].wait()
+            else:
+                break
+
+            self._schedule()
+
+        return uploaded
+
+    def release(self) -> None:
+        '''
+            Stop the background thread and release the staging buffers.
+            The texture keeps the slices uploaded so far.
+        '''
+
+        if self._worker is None:
+            return
+
+        while True:
+            try:
+                self._jobs.get_nowait()
+            except queue.Empty:
+                break
+
+        self._jobs.put(None)
+        self._worker.join()
+
+        for fence, _ in self._retired:
+            fence.release()
+
+        for buffer in self._staging:
+            buffer.release()
+
+        self._worker = None
+        self._retired = []
+
+    def _collect(self, block):
+        uploaded = []
+        error = None
+
+        while True:
+            try:
+                index, first, count, exception = self._done.get(block)
+            except queue.Empty:
+                break
+
+            block = False
+            self._reading -= 1
+
+            if exception is not None:
+                self._free.append(index)
+                error = error or exception
+                continue
+
+            width, height = self._texture._size[:2]
+            self._texture.mglo.write(self._staging[index].mglo, (0, 0, first, width, height, count), 1, None)
+            self._retired.append((self.ctx.fence(), index))
+            self._valid[first:first + count] = b'\x01' * count
+            uploaded.append((first, count))
+
+        if error is not None:
+            raise Error('cannot read slices: %s' % error)
+
+        return uploaded
+
+    def _schedule(self):
+        while self._retired and self._retired[0][0].signaled:
+            fence, index = self._retired.pop(0)
+            self._free.append(index)
+            fence.release()
+
+        while self._free and self._next < self._slices:
+            first = self._next
+            count = min(self._batch, self._slices - first)
+            self._next += count
+            self._reading += 1
+            self._jobs.put((self._free.pop(), first, count))
+
+    def _work(self):
+        while True:
+            job = self._jobs.get()
+            if job is None:
+                break
+
+            index, first, count = job
+            size = count * self._slice_size
+            exception = None
+
+            try:
+                if callable(self._source):
+                    data = memoryview(self._source(first, first + count)).cast('B')
+                    if data.nbytes != size:
+                        raise ValueError('the source returned %d bytes instead of %d' % (data.nbytes, size))
+                else:
+                    data = self._source[first * self._slice_size:first * self._slice_size + size]
+
+                self._staging[index].mglo.load(0, data)
+            except Exception as ex:
+                exception = ex
+
+            self._done.put((index, first, count, exception))
+
+
+def _texture_stream(texture, source, slices_per_batch, buffers):
+    # The slices of block compressed dtypes such as 'bc1' are not whole rows of pixels.
+    if len(texture._dtype) != 2:
+        raise Error('compressed textures cannot be streamed')
+
+    width, height, slices = texture._size
+    slice_size = width * height * texture._components * int(texture._dtype[1:])
+
+    if slices_per_batch < 1 or buffers < 1:
+        raise Error('invalid slices_per_batch = %d or buffers = %d' % (slices_per_batch, buffers))
+
+    if not callable(source):
+        mapping = getattr(source, '_mmap', source)
+        source = memoryview(source).cast('B')
+
+        if source.nbytes != slices * slice_size:
+            raise Error('the source holds %d bytes instead of %d' % (source.nbytes, slices * slice_size))
+
+        if isinstance(mapping, mmap.mmap) and hasattr(mmap, 'MADV_SEQUENTIAL'):
+            mapping.madvise(mmap.MADV_SEQUENTIAL)
+
+    batch = min(slices_per_batch, slices)
+
+    res = TextureStream.__new__(TextureStream)
+    res._texture = texture
+    res._source = source
+    res._slices = slices
+    res._slice_size = slice_size
+    res._batch = batch
+    res._staging = [texture.ctx.stream_buffer(batch * slice_size, regions=1) for _ in range(buffers)]
+    res._next = 0
+    res._valid = bytearray(slices)
+    res._reading = 0
+    res._free = list(reversed(range(buffers)))
+    res._retired = []
+    res._jobs = queue.Queue()
+    res._done = queue.Queue()
+    res._worker = threading.Thread(target=res._work, daemon=True)
+    res.ctx = texture.ctx
+    res.extra = None
+
+    res._worker.start()
+    res._schedule()
+    return res
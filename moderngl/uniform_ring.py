@@ -0,0 +1,85 @@
+__all__ = ['UniformRing']
+
+
+class UniformRing:
+    '''
+        A per-frame allocator for uniform blocks.
+
+        Every :py:meth:`UniformRing.push` copies one block into a persistently mapped
+        :py:class:`StreamBuffer` at the next offset aligned to ``GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT``.
+        The returned range is passed to :py:meth:`VertexArray.render` with ``uniform_block_offsets``
+        and bound with ``glBindBufferRange`` right before the draw.
+        Thousands of draws share a single buffer and no ``glBufferSubData`` call is issued.
+
+        A UniformRing object cannot be instantiated directly, it requires a context.
+        Use :py:meth:`Context.uniform_ring` to create one.
+    '''
+
+    __slots__ = ['_buffer', '_alignment', 'ctx', 'extra']
+
+    def __init__(self):
+        self._buffer = None
+        self._alignment = None
+        self.ctx = None
+        self.extra = None  #: Any - Attribute for storing user defined objects
+        raise TypeError()
+
+    def __repr__(self):
+        return '<UniformRing: %d bytes>' % self._buffer.size
+
+    @property
+    def buffer(self) -> 'StreamBuffer':
+        '''
+            StreamBuffer: The buffer holding the blocks.
+        '''
+
+        return self._buffer
+
+    @property
+    def size(self) -> int:
+        '''
+            int: The size of the ring.
+        '''
+
+        return self._buffer.size
+
+    @property
+    def alignment(self) -> int:
+        '''
+            int: The alignment of the offsets, ``GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT``.
+        '''
+
+        return self._alignment
+
+    def push(self, data) -> tuple:
+        '''
+            Copy a uniform block into the ring.
+
+            The range is valid until the region holding it is reused,
+            it must not be kept across frames.
+
+            Args:
+                data (bytes): The content of the uniform block.
+
+            Returns:
+                tuple: The buffer, offset and size of the range.
+        '''
+
+        offset, size = self._buffer.mglo.push(data, self._alignment)
+        return self._buffer, offset, size
+
+    def advance(self) -> None:
+        '''
+            Finish the current frame.
+
+            Call this once per frame after the draw calls using the blocks were issued.
+        '''
+
+        self._buffer.advance()
+
+    def release(self) -> None:
+        '''
+            Release the buffer of the ring.
+        '''
+
+        self._buffer.release()
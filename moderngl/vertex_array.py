@@ -108,7 +108,7 @@ class VertexArray:
 
         return self._glo
 
-    def render(self, mode=None, vertices=-1, *, first=0, instances=1) -> None:
+    def render(self, mode=None, vertices=-1, *, first=0, instances=1, uniform_block_offsets=None) -> None:
         '''
             The render primitive (mode) must be the same as
             the input primitive of the GeometryShader.
@@ -120,12 +120,22 @@ class VertexArray:
             Keyword Args:
                 first (int): The index of the first vertex to start with.
                 instances (int): The number of instances.
+                uniform_block_offsets (dict): Uniform buffer ranges bound before the draw.
+                    The keys are uniform block bindings, the values are ``(buffer, offset)``
+                    or ``(buffer, offset, size)`` tuples as returned by :py:meth:`UniformRing.push`.
         '''
 
         if mode is None:
             mode = TRIANGLES
 
-        self.mglo.render(mode, vertices, first, instances)
+        ranges = None
+        if uniform_block_offsets:
+            ranges = tuple([
+                (binding, value[0].mglo, value[1], value[2] if len(value) > 2 else -1)
+                for binding, value in uniform_block_offsets.items()
+            ])
+
+        self.mglo.render(mode, vertices, first, instances, ranges)
 
     def render_indirect(self, buffer, mode=None, count=-1, *, first=0) -> None:
         '''
@@ -52,7 +52,7 @@ if target in ['linux', 'cygwin']:
 
 libraries = {
     'windows': ['gdi32', 'opengl32', 'user32'],
-    'linux': ['GL', 'dl', 'X11'],
+    'linux': ['GL', 'dl', 'X11', 'pthread'],
     'cygwin': ['GL', 'X11'],
     'darwin': [],
     'android': [],
@@ -86,13 +86,21 @@ mgl = Extension(
         'src/Attribute.cpp',
         'src/Buffer.cpp',
         'src/BufferFormat.cpp',
+        'src/Chunks.cpp',
+        'src/Compressed.cpp',
         'src/ComputeShader.cpp',
+        'src/ContentHash.cpp',
         'src/Context.cpp',
+        'src/Convert.cpp',
         'src/DataType.cpp',
+        'src/DLPack.cpp',
+        'src/DTypeFormat.cpp',
         'src/Error.cpp',
+        'src/Fence.cpp',
         'src/Framebuffer.cpp',
         'src/GLContext.cpp',
         'src/GLMethods.cpp',
+        'src/Interleave.cpp',
         'src/InvalidObject.cpp',
         'src/ModernGL.cpp',
         'src/Program.cpp',
@@ -102,6 +110,7 @@ mgl = Extension(
         'src/Texture.cpp',
         'src/Texture3D.cpp',
         'src/TextureArray.cpp',
+        'src/TextureBuffer.cpp',
         'src/TextureCube.cpp',
         'src/Uniform.cpp',
         'src/UniformBlock.cpp',
@@ -113,7 +122,7 @@ mgl = Extension(
 
 next_mgl = Extension(
     name='moderngl.next.mgl',
-    include_dirs=['moderngl/next'],
+    include_dirs=['moderngl/next', 'src'],
     define_macros=[
         ('MODERNGL_MODULE', 'moderngl.next'),
     ],
@@ -126,6 +135,7 @@ next_mgl = Extension(
         'moderngl/next/mgl/configuration.cpp',
         'moderngl/next/mgl/context.cpp',
         'moderngl/next/mgl/extensions.cpp',
+        'moderngl/next/mgl/fence.cpp',
         'moderngl/next/mgl/framebuffer.cpp',
         'moderngl/next/mgl/inspect.cpp',
         'moderngl/next/mgl/limits.cpp',
@@ -156,6 +166,7 @@ next_mgl = Extension(
         'moderngl/next/mgl/configuration.hpp',
         'moderngl/next/mgl/context.hpp',
         'moderngl/next/mgl/extensions.hpp',
+        'moderngl/next/mgl/fence.hpp',
         'moderngl/next/mgl/framebuffer.hpp',
         'moderngl/next/mgl/inspect.hpp',
         'moderngl/next/mgl/limits.hpp',
@@ -178,6 +189,7 @@ next_mgl = Extension(
         'moderngl/next/mgl/internal/wrapper.hpp',
         'moderngl/next/mgl/internal/opengl/gl_context.hpp',
         'moderngl/next/mgl/internal/opengl/gl_methods.hpp',
+        'src/Gather.hpp',
     ],
 )
 
@@ -1,13 +1,20 @@
 #include "Types.hpp"
 
+#include "InlineMethods.hpp"
+#include "Chunks.hpp"
+#include "Gather.hpp"
+#include "Interleave.hpp"
+#include "Convert.hpp"
+#include "BufferFormat.hpp"
+
 PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 	PyObject * data;
-	int reserve;
+	Py_ssize_t reserve;
 	int dynamic;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OIp",
+		"Onp",
 		&data,
 		&reserve,
 		&dynamic
@@ -22,6 +29,11 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
+	if (reserve < 0) {
+		MGLError_Set("invalid reserve = %zd", reserve);
+		return 0;
+	}
+
 	if (data != Py_None && reserve) {
 		MGLError_Set("data and reserve are mutually exclusive");
 		return 0;
@@ -50,7 +62,7 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 
 	MGLBuffer * buffer = (MGLBuffer *)MGLBuffer_Type.tp_alloc(&MGLBuffer_Type, 0);
 
-	buffer->size = (int)buffer_view.len;
+	buffer->size = buffer_view.len;
 	buffer->dynamic = dynamic ? true : false;
 
 	const GLMethods & gl = self->gl;
@@ -83,6 +95,137 @@ PyObject * MGLContext_buffer(MGLContext * self, PyObject * args) {
 	return result;
 }
 
+PyObject * MGLContext_stream_buffer(MGLContext * self, PyObject * args) {
+	Py_ssize_t size;
+	int regions;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"nI",
+		&size,
+		&regions
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (regions < 1 || size < regions) {
+		MGLError_Set("invalid size = %zd or regions = %d", size, regions);
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	if (!gl.BufferStorage || !gl.FenceSync) {
+		MGLError_Set("stream buffers require OpenGL 4.4 or ARB_buffer_storage");
+		return 0;
+	}
+
+	MGLBuffer * buffer = (MGLBuffer *)MGLBuffer_Type.tp_alloc(&MGLBuffer_Type, 0);
+
+	buffer->size = size;
+	buffer->dynamic = true;
+
+	buffer->buffer_obj = 0;
+	gl.GenBuffers(1, (GLuint *)&buffer->buffer_obj);
+
+	if (!buffer->buffer_obj) {
+		MGLError_Set("cannot create buffer");
+		Py_DECREF(buffer);
+		return 0;
+	}
+
+	// The map is exported as a readable and writable buffer view, reading it must be defined too.
+	int flags = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+	gl.BufferStorage(GL_ARRAY_BUFFER, size, 0, flags | GL_DYNAMIC_STORAGE_BIT);
+	buffer->persistent_map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+
+	if (!buffer->persistent_map) {
+		MGLError_Set("cannot map the buffer");
+		gl.DeleteBuffers(1, (GLuint *)&buffer->buffer_obj);
+		Py_DECREF(buffer);
+		return 0;
+	}
+
+	buffer->regions = regions;
+	buffer->region = 0;
+	buffer->region_size = size / regions;
+	buffer->region_cursor = 0;
+	buffer->frame_regions = 1;
+	buffer->persistent_exports = 0;
+	buffer->fences = new GLsync[regions]();
+
+	Py_INCREF(self);
+	buffer->context = self;
+
+	Py_INCREF(buffer);
+
+	PyObject * result = PyTuple_New(4);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)buffer);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromSsize_t(buffer->size));
+	PyTuple_SET_ITEM(result, 2, PyLong_FromSsize_t(buffer->region_size));
+	PyTuple_SET_ITEM(result, 3, PyLong_FromLong(buffer->buffer_obj));
+	return result;
+}
+
+PyObject * MGLContext_buffer_arena(MGLContext * self, PyObject * args) {
+	Py_ssize_t size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"n",
+		&size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (size < 1) {
+		MGLError_Set("invalid size = %zd", size);
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	MGLBuffer * buffer = (MGLBuffer *)MGLBuffer_Type.tp_alloc(&MGLBuffer_Type, 0);
+
+	buffer->size = size;
+	buffer->dynamic = true;
+
+	buffer->buffer_obj = 0;
+	gl.GenBuffers(1, (GLuint *)&buffer->buffer_obj);
+
+	if (!buffer->buffer_obj) {
+		MGLError_Set("cannot create buffer");
+		Py_DECREF(buffer);
+		return 0;
+	}
+
+	gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+
+	// Immutable storage lets the driver place the block once, fall back to a plain buffer without it.
+	if (gl.BufferStorage) {
+		gl.BufferStorage(GL_ARRAY_BUFFER, size, 0, GL_DYNAMIC_STORAGE_BIT | GL_MAP_READ_BIT | GL_MAP_WRITE_BIT);
+	} else {
+		gl.BufferData(GL_ARRAY_BUFFER, size, 0, GL_DYNAMIC_DRAW);
+	}
+
+	Py_INCREF(self);
+	buffer->context = self;
+
+	Py_INCREF(buffer);
+
+	PyObject * result = PyTuple_New(3);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)buffer);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromSsize_t(buffer->size));
+	PyTuple_SET_ITEM(result, 2, PyLong_FromLong(buffer->buffer_obj));
+	return result;
+}
+
 PyObject * MGLBuffer_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
 	MGLBuffer * self = (MGLBuffer *)type->tp_alloc(type, 0);
 
@@ -96,38 +239,201 @@ void MGLBuffer_tp_dealloc(MGLBuffer * self) {
 	MGLBuffer_Type.tp_free((PyObject *)self);
 }
 
+PyObject * MGLBuffer_WriteConverted(MGLBuffer * self, PyObject * data, Py_ssize_t offset, PyObject * src_dtype, PyObject * dst_format) {
+	if (!PyUnicode_Check(src_dtype) || !PyUnicode_Check(dst_format)) {
+		MGLError_Set("src_dtype and dst_format must be set together");
+		return 0;
+	}
+
+	ConvertType src_type;
+
+	if (!ConvertType_FromDtype(&src_type, PyUnicode_AsUTF8(src_dtype))) {
+		MGLError_Set("invalid src_dtype");
+		return 0;
+	}
+
+	const char * format = PyUnicode_AsUTF8(dst_format);
+	FormatIterator it = FormatIterator(format);
+	FormatInfo format_info = it.info();
+
+	if (!format_info.valid || !format_info.nodes) {
+		MGLError_Set("invalid dst_format");
+		return 0;
+	}
+
+	int components = 0;
+	bool padding = false;
+
+	while (FormatNode * node = it.next()) {
+		components += node->type ? node->count : 0;
+		padding = padding || !node->type;
+	}
+
+	Py_buffer buffer_view;
+
+	if (PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE) < 0) {
+		PyErr_Clear();
+		MGLError_Set("data (%s) must be a contiguous buffer", Py_TYPE(data)->tp_name);
+		return 0;
+	}
+
+	Py_ssize_t elements = buffer_view.len / src_type.size;
+	Py_ssize_t vertices = elements / components;
+	Py_ssize_t size = vertices * format_info.size;
+
+	if (buffer_view.len != vertices * components * src_type.size) {
+		MGLError_Set("data (%zd bytes) is not a whole number of %d component vertices", buffer_view.len, components);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	if (offset < 0 || offset + size > self->size) {
+		MGLError_Set("out of range offset = %zd or size = %zd", offset, size);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	if (!size) {
+		PyBuffer_Release(&buffer_view);
+		Py_RETURN_NONE;
+	}
+
+	const GLMethods & gl = self->context->gl;
+	char * map = self->persistent_map;
+
+	if (map) {
+		map += offset;
+	} else {
+		// The padding keeps the previous content, the range can only be invalidated without padding.
+		int access = GL_MAP_WRITE_BIT | (padding ? 0 : GL_MAP_INVALIDATE_RANGE_BIT);
+		gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+		map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, offset, size, access);
+	}
+
+	if (!map) {
+		MGLError_Set("cannot map the buffer");
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	const char * src = (const char *)buffer_view.buf;
+
+	if (format_info.nodes == 1 && !padding) {
+		// A single attribute converts as one contiguous run.
+		it = FormatIterator(format);
+		FormatNode * node = it.next();
+		ConvertType dst_type = {node->type, node->size / node->count, node->normalize};
+		ConvertValues(map, dst_type, src, src_type, elements);
+	} else {
+		ConvertType * node_types = new ConvertType[format_info.nodes];
+		int * node_offsets = new int[format_info.nodes];
+		int * node_counts = new int[format_info.nodes];
+
+		int nodes = 0;
+		int node_offset = 0;
+
+		it = FormatIterator(format);
+		while (FormatNode * node = it.next()) {
+			if (node->type) {
+				ConvertType dst_type = {node->type, node->size / node->count, node->normalize};
+				node_types[nodes] = dst_type;
+				node_offsets[nodes] = node_offset;
+				node_counts[nodes] = node->count;
+				nodes += 1;
+			}
+			node_offset += node->size;
+		}
+
+		for (Py_ssize_t i = 0; i < vertices; ++i) {
+			char * dst = map + i * format_info.size;
+			for (int j = 0; j < nodes; ++j) {
+				ConvertValues(dst + node_offsets[j], node_types[j], src, src_type, node_counts[j]);
+				src += node_counts[j] * src_type.size;
+			}
+		}
+
+		delete[] node_types;
+		delete[] node_offsets;
+		delete[] node_counts;
+	}
+
+	if (!self->persistent_map) {
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	}
+
+	PyBuffer_Release(&buffer_view);
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLBuffer_write(MGLBuffer * self, PyObject * args) {
 	PyObject * data;
 	Py_ssize_t offset;
+	PyObject * src_dtype;
+	PyObject * dst_format;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"On",
+		"OnOO",
 		&data,
-		&offset
+		&offset,
+		&src_dtype,
+		&dst_format
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (src_dtype != Py_None || dst_format != Py_None) {
+		return MGLBuffer_WriteConverted(self, data, offset, src_dtype, dst_format);
+	}
+
 	Py_buffer buffer_view;
 
-	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDED_RO);
 	if (get_buffer < 0) {
 		MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 		return 0;
 	}
 
 	if (offset < 0 || buffer_view.len + offset > self->size) {
-		MGLError_Set("out of range offset = %d or size = %d", offset, buffer_view.len);
+		MGLError_Set("out of range offset = %zd or size = %zd", offset, buffer_view.len);
 		PyBuffer_Release(&buffer_view);
 		return 0;
 	}
 
 	const GLMethods & gl = self->context->gl;
 	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-	gl.BufferSubData(GL_ARRAY_BUFFER, (GLintptr)offset, buffer_view.len, buffer_view.buf);
+
+	if (PyBuffer_IsContiguous(&buffer_view, 'C')) {
+		gl.BufferSubData(GL_ARRAY_BUFFER, (GLintptr)offset, buffer_view.len, buffer_view.buf);
+		PyBuffer_Release(&buffer_view);
+		Py_RETURN_NONE;
+	}
+
+	// Strided views, such as a column of a structured array, are gathered straight into the mapped range.
+	char * map = self->persistent_map;
+
+	if (map) {
+		map += offset;
+	} else {
+		map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, offset, buffer_view.len, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+	}
+
+	if (!map) {
+		MGLError_Set("cannot map the buffer");
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	if (!StridedGather(map, &buffer_view)) {
+		PyBuffer_ToContiguous(map, &buffer_view, buffer_view.len, 'C');
+	}
+
+	if (!self->persistent_map) {
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	}
+
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
 }
@@ -152,7 +458,7 @@ PyObject * MGLBuffer_read(MGLBuffer * self, PyObject * args) {
 	}
 
 	if (offset < 0 || offset + size > self->size) {
-		MGLError_Set("out of rangeoffset = %d or size = %d", offset, size);
+		MGLError_Set("out of range offset = %zd or size = %zd", offset, size);
 		return 0;
 	}
 
@@ -258,13 +564,19 @@ PyObject * MGLBuffer_write_chunks(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	if (count <= 0) {
+		MGLError_Set("invalid count = %zd", count);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
 	const GLMethods & gl = self->context->gl;
 	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
 
 	Py_ssize_t chunk_size = buffer_view.len / count;
 
 	if (buffer_view.len != chunk_size * count) {
-		MGLError_Set("data (%d bytes) cannot be divided to %d equal chunks", buffer_view.len, count);
+		MGLError_Set("data (%zd bytes) cannot be divided to %zd equal chunks", buffer_view.len, count);
 		PyBuffer_Release(&buffer_view);
 		return 0;
 	}
@@ -279,25 +591,246 @@ PyObject * MGLBuffer_write_chunks(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	char * write_ptr = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, self->size, GL_MAP_WRITE_BIT);
+	// Only the span covered by the chunks is mapped.
+	Py_ssize_t span_start = step > 0 ? start : start + count * step - step;
+	Py_ssize_t span_size = abs_step * (count - 1) + chunk_size;
+
+	char * write_ptr = self->persistent_map;
+
+	if (write_ptr) {
+		write_ptr += span_start;
+	} else {
+		// The gaps between the chunks keep their content, the span cannot be invalidated unless there are none.
+		int access = GL_MAP_WRITE_BIT | (chunk_size == abs_step ? GL_MAP_INVALIDATE_RANGE_BIT : 0);
+		write_ptr = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, span_start, span_size, access);
+	}
+
 	char * read_ptr = (char *)buffer_view.buf;
 
-	if (!write_ptr) {
+	if (!write_ptr) {
+		MGLError_Set("cannot map the buffer");
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	write_ptr += start - span_start;
+
+	Py_BEGIN_ALLOW_THREADS
+	CopyChunks(write_ptr, step, read_ptr, chunk_size, chunk_size, count);
+	Py_END_ALLOW_THREADS
+
+	if (!self->persistent_map) {
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	}
+
+	PyBuffer_Release(&buffer_view);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLBuffer_write_many(MGLBuffer * self, PyObject * args) {
+	PyObject * ranges;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O",
+		&ranges
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	PyObject * seq = PySequence_Fast(ranges, "ranges must be a sequence");
+
+	if (!seq) {
+		return 0;
+	}
+
+	Py_ssize_t num_ranges = PySequence_Fast_GET_SIZE(seq);
+
+	if (!num_ranges) {
+		Py_DECREF(seq);
+		Py_RETURN_NONE;
+	}
+
+	Py_ssize_t * offsets = new Py_ssize_t[num_ranges];
+	Py_buffer * views = new Py_buffer[num_ranges];
+	Py_ssize_t num_views = 0;
+
+	Py_ssize_t first = self->size;
+	Py_ssize_t last = 0;
+
+	// Everything is validated before the buffer is mapped, so a bad range does not leave a partial write.
+	for (Py_ssize_t i = 0; i < num_ranges; ++i) {
+		PyObject * item = PySequence_Fast_GET_ITEM(seq, i);
+
+		if (!PyTuple_Check(item) || PyTuple_GET_SIZE(item) != 2) {
+			MGLError_Set("ranges[%zd] must be a tuple of offset and data", i);
+			break;
+		}
+
+		offsets[i] = PyLong_AsSsize_t(PyTuple_GET_ITEM(item, 0));
+
+		if (PyErr_Occurred()) {
+			PyErr_Clear();
+			MGLError_Set("ranges[%zd][0] must be an int", i);
+			break;
+		}
+
+		PyObject * data = PyTuple_GET_ITEM(item, 1);
+
+		if (PyObject_GetBuffer(data, &views[i], PyBUF_SIMPLE) < 0) {
+			PyErr_Clear();
+			MGLError_Set("ranges[%zd][1] (%s) does not support buffer interface", i, Py_TYPE(data)->tp_name);
+			break;
+		}
+
+		num_views += 1;
+
+		if (offsets[i] < 0 || offsets[i] + views[i].len > self->size) {
+			MGLError_Set("ranges[%zd] is out of range offset = %zd or size = %zd", i, offsets[i], views[i].len);
+			break;
+		}
+
+		if (views[i].len) {
+			first = offsets[i] < first ? offsets[i] : first;
+			last = offsets[i] + views[i].len > last ? offsets[i] + views[i].len : last;
+		}
+	}
+
+	bool valid = num_views == num_ranges && !PyErr_Occurred();
+
+	if (valid && first < last) {
+		if (self->persistent_map) {
+			for (Py_ssize_t i = 0; i < num_ranges; ++i) {
+				memcpy(self->persistent_map + offsets[i], views[i].buf, views[i].len);
+			}
+		} else {
+			const GLMethods & gl = self->context->gl;
+			gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+
+			// Map the span covering every range once, then flush only the bytes that were written.
+			char * map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, first, last - first, GL_MAP_WRITE_BIT | GL_MAP_FLUSH_EXPLICIT_BIT);
+
+			if (map) {
+				for (Py_ssize_t i = 0; i < num_ranges; ++i) {
+					if (views[i].len) {
+						memcpy(map + offsets[i] - first, views[i].buf, views[i].len);
+						gl.FlushMappedBufferRange(GL_ARRAY_BUFFER, offsets[i] - first, views[i].len);
+					}
+				}
+				gl.UnmapBuffer(GL_ARRAY_BUFFER);
+			} else {
+				MGLError_Set("cannot map the buffer");
+				valid = false;
+			}
+		}
+	}
+
+	for (Py_ssize_t i = 0; i < num_views; ++i) {
+		PyBuffer_Release(&views[i]);
+	}
+
+	delete[] views;
+	delete[] offsets;
+	Py_DECREF(seq);
+
+	if (!valid) {
+		return 0;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLBuffer_write_interleaved(MGLBuffer * self, PyObject * args) {
+	const char * format;
+	PyObject * arrays;
+	Py_ssize_t offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"sO!n",
+		&format,
+		&PyTuple_Type,
+		&arrays,
+		&offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	InterleaveLayout layout;
+
+	if (!InterleaveLayout_Init(&layout, format, arrays)) {
+		return 0;
+	}
+
+	Py_ssize_t size = layout.vertices * layout.stride;
+
+	if (offset < 0 || offset + size > self->size) {
+		MGLError_Set("out of range offset = %zd or size = %zd", offset, size);
+		InterleaveLayout_Release(&layout);
+		return 0;
+	}
+
+	if (!size) {
+		InterleaveLayout_Release(&layout);
+		Py_RETURN_NONE;
+	}
+
+	const GLMethods & gl = self->context->gl;
+	char * map = self->persistent_map;
+
+	if (map) {
+		map += offset;
+	} else {
+		// The padding keeps the previous content, the range can only be invalidated without padding.
+		int access = GL_MAP_WRITE_BIT | (layout.padding ? 0 : GL_MAP_INVALIDATE_RANGE_BIT);
+		gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+		map = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, offset, size, access);
+	}
+
+	if (!map) {
+		MGLError_Set("cannot map the buffer");
+		InterleaveLayout_Release(&layout);
+		return 0;
+	}
+
+	InterleaveLayout_Write(&layout, map);
+
+	if (!self->persistent_map) {
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	}
+
+	InterleaveLayout_Release(&layout);
+	Py_RETURN_NONE;
+}
+
+bool MGLBuffer_ReadChunksInto(MGLBuffer * self, char * write_ptr, Py_ssize_t chunk_size, Py_ssize_t start, Py_ssize_t step, Py_ssize_t count) {
+	const GLMethods & gl = self->context->gl;
+
+	// Only the span covered by the chunks is mapped.
+	Py_ssize_t span_start = step > 0 ? start : start + count * step - step;
+	Py_ssize_t span_size = (step > 0 ? step : -step) * (count - 1) + chunk_size;
+
+	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+
+	char * read_ptr = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, span_start, span_size, GL_MAP_READ_BIT);
+
+	if (!read_ptr) {
 		MGLError_Set("cannot map the buffer");
-		PyBuffer_Release(&buffer_view);
-		return 0;
+		return false;
 	}
 
-	write_ptr += start;
-	for (Py_ssize_t i = 0; i < count; ++i) {
-		memcpy(write_ptr, read_ptr, chunk_size);
-		read_ptr += chunk_size;
-		write_ptr += step;
-	}
+	read_ptr += start - span_start;
+
+	Py_BEGIN_ALLOW_THREADS
+	CopyChunks(write_ptr, chunk_size, read_ptr, step, chunk_size, count);
+	Py_END_ALLOW_THREADS
 
 	gl.UnmapBuffer(GL_ARRAY_BUFFER);
-	PyBuffer_Release(&buffer_view);
-	Py_RETURN_NONE;
+	return true;
 }
 
 PyObject * MGLBuffer_read_chunks(MGLBuffer * self, PyObject * args) {
@@ -330,28 +863,21 @@ PyObject * MGLBuffer_read_chunks(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
-
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+	if (count <= 0) {
+		return PyBytes_FromStringAndSize(0, 0);
+	}
 
-	char * read_ptr = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, self->size, GL_MAP_READ_BIT);
+	PyObject * data = PyBytes_FromStringAndSize(0, chunk_size * count);
 
-	if (!read_ptr) {
-		MGLError_Set("cannot map the buffer");
+	if (!data) {
 		return 0;
 	}
 
-	PyObject * data = PyBytes_FromStringAndSize(0, chunk_size * count);
-	char * write_ptr = PyBytes_AS_STRING(data);
-
-	read_ptr += start;
-	for (Py_ssize_t i = 0; i < count; ++i) {
-		memcpy(write_ptr, read_ptr, chunk_size);
-		write_ptr += chunk_size;
-		read_ptr += step;
+	if (!MGLBuffer_ReadChunksInto(self, PyBytes_AS_STRING(data), chunk_size, start, step, count)) {
+		Py_DECREF(data);
+		return 0;
 	}
 
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
 	return data;
 }
 
@@ -378,6 +904,17 @@ PyObject * MGLBuffer_read_chunks_into(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
+	Py_ssize_t abs_step = step > 0 ? step : -step;
+
+	if (start < 0) {
+		start = self->size + start;
+	}
+
+	if (start < 0 || chunk_size < 0 || chunk_size > abs_step || start + chunk_size > self->size || start + count * step - step < 0 || start + count * step - step + chunk_size > self->size) {
+		MGLError_Set("size error");
+		return 0;
+	}
+
 	Py_buffer buffer_view;
 
 	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_WRITABLE);
@@ -386,26 +923,17 @@ PyObject * MGLBuffer_read_chunks_into(MGLBuffer * self, PyObject * args) {
 		return 0;
 	}
 
-	const GLMethods & gl = self->context->gl;
-
-	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
-
-	char * read_ptr = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, 0, self->size, GL_MAP_READ_BIT);
-	char * write_ptr = (char *)buffer_view.buf + write_offset;
-
-	if (!read_ptr) {
-		MGLError_Set("cannot map the buffer");
+	if (write_offset < 0 || write_offset + chunk_size * count > buffer_view.len) {
+		MGLError_Set("out of range write_offset = %zd or size = %zd", write_offset, chunk_size * count);
+		PyBuffer_Release(&buffer_view);
 		return 0;
 	}
 
-	read_ptr += start;
-	for (Py_ssize_t i = 0; i < count; ++i) {
-		memcpy(write_ptr, read_ptr, chunk_size);
-		write_ptr += chunk_size;
-		read_ptr += step;
+	if (count > 0 && !MGLBuffer_ReadChunksInto(self, (char *)buffer_view.buf + write_offset, chunk_size, start, step, count)) {
+		PyBuffer_Release(&buffer_view);
+		return 0;
 	}
 
-	gl.UnmapBuffer(GL_ARRAY_BUFFER);
 	PyBuffer_Release(&buffer_view);
 	Py_RETURN_NONE;
 }
@@ -539,7 +1067,347 @@ PyObject * MGLBuffer_bind_to_storage_buffer(MGLBuffer * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+void MGLBuffer_WaitRegion(MGLBuffer * self, int region) {
+	GLsync fence = self->fences[region];
+
+	if (!fence) {
+		return;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	GLenum status = gl.ClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+	if (status == GL_TIMEOUT_EXPIRED) {
+		Py_BEGIN_ALLOW_THREADS
+		do {
+			status = gl.ClientWaitSync(fence, 0, 1000000);
+		} while (status == GL_TIMEOUT_EXPIRED);
+		Py_END_ALLOW_THREADS
+	}
+
+	gl.DeleteSync(fence);
+	self->fences[region] = 0;
+}
+
+void MGLBuffer_NextRegion(MGLBuffer * self) {
+	const GLMethods & gl = self->context->gl;
+
+	// The draw calls reading the regions written since the last advance are issued by now.
+	for (int i = 0; i < self->frame_regions; ++i) {
+		self->fences[(self->region - i + self->regions) % self->regions] = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	self->region = (self->region + 1) % self->regions;
+	self->region_cursor = 0;
+	self->frame_regions = 1;
+
+	// Block only if the GPU is still reading the region written N advances ago.
+	MGLBuffer_WaitRegion(self, self->region);
+}
+
+PyObject * MGLBuffer_advance(MGLBuffer * self) {
+	if (!self->persistent_map) {
+		MGLError_Set("not a stream buffer");
+		return 0;
+	}
+
+	if (self->region_cursor) {
+		MGLBuffer_NextRegion(self);
+	}
+
+	Py_RETURN_NONE;
+}
+
+// Returns -1 if the size does not fit in a region and -2 if every region was written since the last advance.
+// Staged uploads are issued right after the copy, a full region is fenced at once instead of waiting for advance.
+Py_ssize_t MGLBuffer_Allocate(MGLBuffer * self, Py_ssize_t size, Py_ssize_t alignment, bool staged) {
+	if (size > self->region_size) {
+		return -1;
+	}
+
+	Py_ssize_t region_offset = self->region_size * self->region;
+	Py_ssize_t cursor = (region_offset + self->region_cursor + alignment - 1) / alignment * alignment - region_offset;
+
+	if (cursor + size > self->region_size) {
+		if (staged) {
+			MGLBuffer_NextRegion(self);
+		} else if (self->frame_regions < self->regions) {
+			// The draw calls reading the current region may not be issued yet, it is fenced by advance.
+			self->region = (self->region + 1) % self->regions;
+			self->region_cursor = 0;
+			self->frame_regions += 1;
+			MGLBuffer_WaitRegion(self, self->region);
+		} else {
+			return -2;
+		}
+
+		region_offset = self->region_size * self->region;
+		cursor = (region_offset + alignment - 1) / alignment * alignment - region_offset;
+
+		if (cursor + size > self->region_size) {
+			return -1;
+		}
+	}
+
+	self->region_cursor = cursor + size;
+	return region_offset + cursor;
+}
+
+Py_ssize_t MGLBuffer_Stage(MGLBuffer * self, const void * data, Py_ssize_t size) {
+	// Pixel unpack offsets must be a multiple of the pixel type size.
+	Py_ssize_t offset = MGLBuffer_Allocate(self, size, 16, true);
+
+	if (offset >= 0) {
+		memcpy(self->persistent_map + offset, data, size);
+	}
+
+	return offset;
+}
+
+PyObject * MGLBuffer_allocate(MGLBuffer * self, PyObject * args) {
+	Py_ssize_t size;
+	Py_ssize_t alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"nn",
+		&size,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!self->persistent_map) {
+		MGLError_Set("not a stream buffer");
+		return 0;
+	}
+
+	if (alignment < 1) {
+		MGLError_Set("invalid alignment = %zd", alignment);
+		return 0;
+	}
+
+	if (size < 1) {
+		MGLError_Set("invalid size = %zd", size);
+		return 0;
+	}
+
+	Py_ssize_t offset = MGLBuffer_Allocate(self, size, alignment, false);
+
+	if (offset == -2) {
+		MGLError_Set("the stream buffer is full, call advance() after the draw calls reading its allocations");
+		return 0;
+	}
+
+	if (offset < 0) {
+		MGLError_Set("the size = %zd does not fit in a region of %zd bytes with alignment = %zd", size, self->region_size, alignment);
+		return 0;
+	}
+
+	// The view is sliced from an export of the buffer, it keeps the buffer alive and blocks release.
+	PyObject * view = PyMemoryView_FromObject((PyObject *)self);
+	if (!view) {
+		return 0;
+	}
+
+	PyObject * start = PyLong_FromSsize_t(offset);
+	PyObject * stop = PyLong_FromSsize_t(offset + size);
+	PyObject * slice = PySlice_New(start, stop, 0);
+	PyObject * memory = PyObject_GetItem(view, slice);
+	Py_DECREF(slice);
+	Py_DECREF(start);
+	Py_DECREF(stop);
+	Py_DECREF(view);
+
+	if (!memory) {
+		return 0;
+	}
+
+	return tuple2(PyLong_FromSsize_t(offset), memory);
+}
+
+PyObject * MGLBuffer_push(MGLBuffer * self, PyObject * args) {
+	PyObject * data;
+	Py_ssize_t alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"On",
+		&data,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!self->persistent_map) {
+		MGLError_Set("not a stream buffer");
+		return 0;
+	}
+
+	if (alignment < 1) {
+		MGLError_Set("invalid alignment = %zd", alignment);
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_C_CONTIGUOUS);
+	if (get_buffer < 0) {
+		MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+		return 0;
+	}
+
+	if (buffer_view.len < 1) {
+		MGLError_Set("invalid size = %zd", buffer_view.len);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	Py_ssize_t offset = MGLBuffer_Allocate(self, buffer_view.len, alignment, false);
+
+	if (offset == -2) {
+		MGLError_Set("the stream buffer is full, call advance() after the draw calls reading its allocations");
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	if (offset < 0) {
+		MGLError_Set("the size = %zd does not fit in a region of %zd bytes with alignment = %zd", buffer_view.len, self->region_size, alignment);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	memcpy(self->persistent_map + offset, buffer_view.buf, buffer_view.len);
+	PyBuffer_Release(&buffer_view);
+	return tuple2(PyLong_FromSsize_t(offset), PyLong_FromSsize_t(buffer_view.len));
+}
+
+// Copies into the persistent map without GL calls, it is safe to call from other threads.
+PyObject * MGLBuffer_load(MGLBuffer * self, PyObject * args) {
+	Py_ssize_t offset;
+	PyObject * data;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"nO",
+		&offset,
+		&data
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!self->persistent_map) {
+		MGLError_Set("not a stream buffer");
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_C_CONTIGUOUS);
+	if (get_buffer < 0) {
+		MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+		return 0;
+	}
+
+	if (offset < 0 || buffer_view.len + offset > self->size) {
+		MGLError_Set("out of range offset = %zd or size = %zd", offset, buffer_view.len);
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	// Reading memory mapped files page faults here, other threads keep running.
+	Py_BEGIN_ALLOW_THREADS
+	memcpy(self->persistent_map + offset, buffer_view.buf, buffer_view.len);
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&buffer_view);
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLBuffer_map(MGLBuffer * self, PyObject * args) {
+	Py_ssize_t offset;
+	Py_ssize_t size;
+	const char * access;
+	int invalidate;
+	int unsynchronized;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"nnspp",
+		&offset,
+		&size,
+		&access,
+		&invalidate,
+		&unsynchronized
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (size < 0) {
+		size = self->size - offset;
+	}
+
+	if (offset < 0 || size < 1 || offset + size > self->size) {
+		MGLError_Set("out of range offset = %zd or size = %zd", offset, size);
+		return 0;
+	}
+
+	int map_access = 0;
+
+	if (!strcmp(access, "r")) {
+		map_access = GL_MAP_READ_BIT;
+	} else if (!strcmp(access, "w")) {
+		map_access = GL_MAP_WRITE_BIT;
+	} else if (!strcmp(access, "rw")) {
+		map_access = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT;
+	} else {
+		MGLError_Set("invalid access = '%s'", access);
+		return 0;
+	}
+
+	if ((invalidate || unsynchronized) && (map_access & GL_MAP_READ_BIT)) {
+		MGLError_Set("invalidate and unsynchronized require write only access");
+		return 0;
+	}
+
+	if (invalidate) {
+		map_access |= GL_MAP_INVALIDATE_RANGE_BIT;
+	}
+
+	if (unsynchronized) {
+		map_access |= GL_MAP_UNSYNCHRONIZED_BIT;
+	}
+
+	if (self->persistent_map) {
+		MGLError_Set("stream buffers are always mapped");
+		return 0;
+	}
+
+	// The memoryview requests the buffer right away, the range is consumed by the get_view call.
+	self->map_offset = offset;
+	self->map_size = size;
+	self->map_access = map_access;
+
+	PyObject * memory = PyMemoryView_FromObject((PyObject *)self);
+	self->map_access = 0;
+	return memory;
+}
+
 PyObject * MGLBuffer_release(MGLBuffer * self) {
+	if (self->persistent_exports) {
+		PyErr_Format(PyExc_BufferError, "the stream buffer is still exported to %d memoryviews", self->persistent_exports);
+		return 0;
+	}
+
 	MGLBuffer_Invalidate(self);
 	Py_RETURN_NONE;
 }
@@ -549,17 +1417,53 @@ PyMethodDef MGLBuffer_tp_methods[] = {
 	{"read", (PyCFunction)MGLBuffer_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLBuffer_read_into, METH_VARARGS, 0},
 	{"write_chunks", (PyCFunction)MGLBuffer_write_chunks, METH_VARARGS, 0},
+	{"write_many", (PyCFunction)MGLBuffer_write_many, METH_VARARGS, 0},
+	{"write_interleaved", (PyCFunction)MGLBuffer_write_interleaved, METH_VARARGS, 0},
 	{"read_chunks", (PyCFunction)MGLBuffer_read_chunks, METH_VARARGS, 0},
 	{"read_chunks_into", (PyCFunction)MGLBuffer_read_chunks_into, METH_VARARGS, 0},
 	{"clear", (PyCFunction)MGLBuffer_clear, METH_VARARGS, 0},
 	{"orphan", (PyCFunction)MGLBuffer_orphan, METH_NOARGS, 0},
 	{"bind_to_uniform_block", (PyCFunction)MGLBuffer_bind_to_uniform_block, METH_VARARGS, 0},
 	{"bind_to_storage_buffer", (PyCFunction)MGLBuffer_bind_to_storage_buffer, METH_VARARGS, 0},
+	{"allocate", (PyCFunction)MGLBuffer_allocate, METH_VARARGS, 0},
+	{"push", (PyCFunction)MGLBuffer_push, METH_VARARGS, 0},
+	{"load", (PyCFunction)MGLBuffer_load, METH_VARARGS, 0},
+	{"advance", (PyCFunction)MGLBuffer_advance, METH_NOARGS, 0},
+	{"map", (PyCFunction)MGLBuffer_map, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLBuffer_release, METH_NOARGS, 0},
 	{0},
 };
 
 int MGLBuffer_tp_as_buffer_get_view(MGLBuffer * self, Py_buffer * view, int flags) {
+	if (self->persistent_map) {
+		if (PyBuffer_FillInfo(view, (PyObject *)self, self->persistent_map, self->size, 0, flags) < 0) {
+			return -1;
+		}
+
+		self->persistent_exports += 1;
+		return 0;
+	}
+
+	if (self->map_access) {
+		if ((flags & PyBUF_WRITABLE) && !(self->map_access & GL_MAP_WRITE_BIT)) {
+			PyErr_Format(PyExc_BufferError, "Cannot map buffer for writing");
+			view->obj = 0;
+			return -1;
+		}
+
+		const GLMethods & gl = self->context->gl;
+		gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
+		void * map = gl.MapBufferRange(GL_ARRAY_BUFFER, self->map_offset, self->map_size, self->map_access);
+
+		if (!map) {
+			PyErr_Format(PyExc_BufferError, "Cannot map buffer");
+			view->obj = 0;
+			return -1;
+		}
+
+		return PyBuffer_FillInfo(view, (PyObject *)self, map, self->map_size, !(self->map_access & GL_MAP_WRITE_BIT), flags);
+	}
+
 	int access = (flags == PyBUF_SIMPLE) ? GL_MAP_READ_BIT : (GL_MAP_READ_BIT | GL_MAP_WRITE_BIT);
 
 	const GLMethods & gl = self->context->gl;
@@ -588,7 +1492,14 @@ int MGLBuffer_tp_as_buffer_get_view(MGLBuffer * self, Py_buffer * view, int flag
 }
 
 void MGLBuffer_tp_as_buffer_release_view(MGLBuffer * self, Py_buffer * view) {
+	if (self->persistent_map) {
+		self->persistent_exports -= 1;
+		return;
+	}
+
+	// Other buffers may have been bound to GL_ARRAY_BUFFER since the view was created.
 	const GLMethods & gl = self->context->gl;
+	gl.BindBuffer(GL_ARRAY_BUFFER, self->buffer_obj);
 	gl.UnmapBuffer(GL_ARRAY_BUFFER);
 }
 
@@ -646,6 +1557,21 @@ void MGLBuffer_Invalidate(MGLBuffer * buffer) {
 	// TODO: decref
 
 	const GLMethods & gl = buffer->context->gl;
+
+	if (buffer->persistent_map) {
+		for (int i = 0; i < buffer->regions; ++i) {
+			if (buffer->fences[i]) {
+				gl.DeleteSync(buffer->fences[i]);
+			}
+		}
+
+		delete[] buffer->fences;
+
+		gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+		buffer->persistent_map = 0;
+	}
+
 	gl.DeleteBuffers(1, (GLuint *)&buffer->buffer_obj);
 
 	Py_TYPE(buffer) = &MGLInvalidObject_Type;
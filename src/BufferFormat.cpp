@@ -78,6 +78,19 @@ FormatNode * FormatIterator::next() {
 				}
 				switch (*ptr++) {
 					case '1':
+						if (*ptr == '0') {
+							// Four unsigned normalized components packed into 10, 10, 10 and 2 bits.
+							if (*++ptr && *ptr != ' ' && *ptr != '/') {
+								return InvalidFormat;
+							}
+							if (node.count != 4) {
+								return InvalidFormat;
+							}
+							node.size = 4;
+							node.type = GL_UNSIGNED_INT_2_10_10_10_REV;
+							node.normalize = true;
+							break;
+						}
 						if (*ptr && *ptr != ' ' && *ptr != '/') {
 							return InvalidFormat;
 						}
@@ -200,6 +213,43 @@ FormatNode * FormatIterator::next() {
 				}
 				return &node;
 
+			case 'n':
+				if (node.count == 0) {
+					node.count = 1;
+				}
+				node.normalize = true;
+				switch (*ptr++) {
+					case '1':
+						if (*ptr == '0') {
+							// Four signed normalized components packed into 10, 10, 10 and 2 bits.
+							if (*++ptr && *ptr != ' ' && *ptr != '/') {
+								return InvalidFormat;
+							}
+							if (node.count != 4) {
+								return InvalidFormat;
+							}
+							node.size = 4;
+							node.type = GL_INT_2_10_10_10_REV;
+							break;
+						}
+						if (*ptr && *ptr != ' ' && *ptr != '/') {
+							return InvalidFormat;
+						}
+						node.size = 1 * node.count;
+						node.type = GL_BYTE;
+						break;
+					case '2':
+						if (*ptr && *ptr != ' ' && *ptr != '/') {
+							return InvalidFormat;
+						}
+						node.size = 2 * node.count;
+						node.type = GL_SHORT;
+						break;
+					default:
+						return InvalidFormat;
+				}
+				return &node;
+
 			case 'x':
 				if (node.count == 0) {
 					node.count = 1;
@@ -0,0 +1,340 @@
+#include "Chunks.hpp"
+
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MGL_CHUNKS_SSE2
+#include <emmintrin.h>
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// Copies smaller than this run on the calling thread, each worker gets at least a quarter of it.
+const Py_ssize_t ParallelCopyThreshold = 8 * 1024 * 1024;
+const int MaxCopyWorkers = 4;
+
+struct ChunkJob {
+	char * dst;
+	Py_ssize_t dst_step;
+	const char * src;
+	Py_ssize_t src_step;
+	Py_ssize_t chunk_size;
+	Py_ssize_t count;
+};
+
+template <int size>
+void CopyFixedChunks(char * dst, Py_ssize_t dst_step, const char * src, Py_ssize_t src_step, Py_ssize_t count) {
+	// The constant sized copies compile to plain moves.
+	for (Py_ssize_t i = 0; i < count; ++i) {
+		memcpy(dst, src, size);
+		dst += dst_step;
+		src += src_step;
+	}
+}
+
+#ifdef MGL_CHUNKS_SSE2
+
+template <int vectors>
+void CopyVectorChunks(char * dst, Py_ssize_t dst_step, const char * src, Py_ssize_t src_step, Py_ssize_t count) {
+	for (Py_ssize_t i = 0; i < count; ++i) {
+		__m128i item[vectors];
+		for (int k = 0; k < vectors; ++k) {
+			item[k] = _mm_loadu_si128((const __m128i *)(src + k * 16));
+		}
+		for (int k = 0; k < vectors; ++k) {
+			_mm_storeu_si128((__m128i *)(dst + k * 16), item[k]);
+		}
+		dst += dst_step;
+		src += src_step;
+	}
+}
+
+#endif
+
+void RunChunkJob(const ChunkJob & job) {
+	char * dst = job.dst;
+	const char * src = job.src;
+
+	// Contiguous chunks on both sides are a single copy.
+	if (job.dst_step == job.chunk_size && job.src_step == job.chunk_size) {
+		memcpy(dst, src, job.chunk_size * job.count);
+		return;
+	}
+
+	switch (job.chunk_size) {
+		case 4:
+			CopyFixedChunks<4>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+
+		case 8:
+			CopyFixedChunks<8>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+
+		case 12:
+			CopyFixedChunks<12>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+
+#ifdef MGL_CHUNKS_SSE2
+		case 16:
+			CopyVectorChunks<1>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+
+		case 32:
+			CopyVectorChunks<2>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+
+		case 64:
+			CopyVectorChunks<4>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+#else
+		case 16:
+			CopyFixedChunks<16>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+
+		case 32:
+			CopyFixedChunks<32>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+
+		case 64:
+			CopyFixedChunks<64>(dst, job.dst_step, src, job.src_step, job.count);
+			return;
+#endif
+	}
+
+	for (Py_ssize_t i = 0; i < job.count; ++i) {
+		memcpy(dst, src, job.chunk_size);
+		dst += job.dst_step;
+		src += job.src_step;
+	}
+}
+
+// The workers are started on the first large copy and live as long as the process.
+// Starting threads for every call costs more than the copies of a few megabytes they share.
+#ifdef _WIN32
+
+typedef SRWLOCK PoolLock;
+typedef CONDITION_VARIABLE PoolSignal;
+
+#define POOL_LOCK_INIT SRWLOCK_INIT
+#define POOL_SIGNAL_INIT CONDITION_VARIABLE_INIT
+
+inline void Lock(PoolLock * lock) {
+	AcquireSRWLockExclusive(lock);
+}
+
+inline bool TryLock(PoolLock * lock) {
+	return TryAcquireSRWLockExclusive(lock) != 0;
+}
+
+inline void Unlock(PoolLock * lock) {
+	ReleaseSRWLockExclusive(lock);
+}
+
+inline void Wait(PoolSignal * signal, PoolLock * lock) {
+	SleepConditionVariableSRW(signal, lock, INFINITE, 0);
+}
+
+inline void WakeAll(PoolSignal * signal) {
+	WakeAllConditionVariable(signal);
+}
+
+#else
+
+typedef pthread_mutex_t PoolLock;
+typedef pthread_cond_t PoolSignal;
+
+#define POOL_LOCK_INIT PTHREAD_MUTEX_INITIALIZER
+#define POOL_SIGNAL_INIT PTHREAD_COND_INITIALIZER
+
+inline void Lock(PoolLock * lock) {
+	pthread_mutex_lock(lock);
+}
+
+inline bool TryLock(PoolLock * lock) {
+	return !pthread_mutex_trylock(lock);
+}
+
+inline void Unlock(PoolLock * lock) {
+	pthread_mutex_unlock(lock);
+}
+
+inline void Wait(PoolSignal * signal, PoolLock * lock) {
+	pthread_cond_wait(signal, lock);
+}
+
+inline void WakeAll(PoolSignal * signal) {
+	pthread_cond_broadcast(signal);
+}
+
+#endif
+
+struct ChunkPool {
+	// The lock guards the jobs and counters, submit is held by the copy owning the current jobs.
+	PoolLock lock;
+	PoolLock submit;
+	PoolSignal work;
+	PoolSignal done;
+
+	ChunkJob * jobs;
+	int num_jobs;
+	int next_job;
+	int remaining;
+
+	bool started;
+	int workers;
+
+#ifndef _WIN32
+	pid_t pid;
+#endif
+};
+
+ChunkPool pool = {POOL_LOCK_INIT, POOL_LOCK_INIT, POOL_SIGNAL_INIT, POOL_SIGNAL_INIT};
+
+// Runs the queued jobs until none is left, the lock is held on entry and on return.
+void DrainChunkJobs() {
+	while (pool.next_job < pool.num_jobs) {
+		ChunkJob job = pool.jobs[pool.next_job++];
+		Unlock(&pool.lock);
+		RunChunkJob(job);
+		Lock(&pool.lock);
+
+		if (--pool.remaining == 0) {
+			WakeAll(&pool.done);
+		}
+	}
+}
+
+void RunChunkWorker() {
+	Lock(&pool.lock);
+	while (true) {
+		while (pool.next_job >= pool.num_jobs) {
+			Wait(&pool.work, &pool.lock);
+		}
+		DrainChunkJobs();
+	}
+}
+
+#ifdef _WIN32
+
+DWORD WINAPI ChunkWorker(void * arg) {
+	RunChunkWorker();
+	return 0;
+}
+
+bool StartChunkWorker() {
+	HANDLE thread = CreateThread(0, 0, ChunkWorker, 0, 0, 0);
+	if (!thread) {
+		return false;
+	}
+	CloseHandle(thread);
+	return true;
+}
+
+int CopyWorkers() {
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	int cpus = (int)info.dwNumberOfProcessors;
+	return cpus < MaxCopyWorkers ? (cpus > 1 ? cpus : 1) : MaxCopyWorkers;
+}
+
+#else
+
+void * ChunkWorker(void * arg) {
+	RunChunkWorker();
+	return 0;
+}
+
+bool StartChunkWorker() {
+	pthread_t thread;
+	if (pthread_create(&thread, 0, ChunkWorker, 0)) {
+		return false;
+	}
+	pthread_detach(thread);
+	return true;
+}
+
+int CopyWorkers() {
+	int cpus = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	return cpus < MaxCopyWorkers ? (cpus > 1 ? cpus : 1) : MaxCopyWorkers;
+}
+
+#endif
+
+void CopyChunks(char * dst, Py_ssize_t dst_step, const char * src, Py_ssize_t src_step, Py_ssize_t chunk_size, Py_ssize_t count) {
+	static int workers = CopyWorkers();
+
+	ChunkJob jobs[MaxCopyWorkers];
+
+	int num_jobs = workers;
+
+	if (chunk_size * count < ParallelCopyThreshold) {
+		num_jobs = 1;
+	}
+
+	Py_ssize_t first = 0;
+
+	for (int i = 0; i < num_jobs; ++i) {
+		Py_ssize_t last = count * (i + 1) / num_jobs;
+		jobs[i].dst = dst + first * dst_step;
+		jobs[i].dst_step = dst_step;
+		jobs[i].src = src + first * src_step;
+		jobs[i].src_step = src_step;
+		jobs[i].chunk_size = chunk_size;
+		jobs[i].count = last - first;
+		first = last;
+	}
+
+	// Concurrent copies do not wait for the pool, they run on their own thread.
+	if (num_jobs == 1 || !TryLock(&pool.submit)) {
+		for (int i = 0; i < num_jobs; ++i) {
+			RunChunkJob(jobs[i]);
+		}
+		return;
+	}
+
+	if (!pool.started) {
+		pool.started = true;
+#ifndef _WIN32
+		pool.pid = getpid();
+#endif
+		for (int i = 1; i < workers; ++i) {
+			pool.workers += StartChunkWorker();
+		}
+	}
+
+#ifndef _WIN32
+	// The workers are not inherited by a forked child.
+	if (pool.pid != getpid()) {
+		for (int i = 0; i < num_jobs; ++i) {
+			RunChunkJob(jobs[i]);
+		}
+		Unlock(&pool.submit);
+		return;
+	}
+#endif
+
+	// The calling thread takes jobs too, the copy completes even if no worker could start.
+	Lock(&pool.lock);
+	pool.jobs = jobs;
+	pool.num_jobs = num_jobs;
+	pool.next_job = 0;
+	pool.remaining = num_jobs;
+	WakeAll(&pool.work);
+
+	DrainChunkJobs();
+
+	while (pool.remaining) {
+		Wait(&pool.done, &pool.lock);
+	}
+
+	pool.jobs = 0;
+	pool.num_jobs = 0;
+	pool.next_job = 0;
+	Unlock(&pool.lock);
+	Unlock(&pool.submit);
+}
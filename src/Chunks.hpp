@@ -0,0 +1,7 @@
+#pragma once
+
+#include "Python.hpp"
+
+// Copies count chunks of chunk_size bytes, the consecutive chunks are step bytes apart on both sides.
+// Large copies are split between a few persistent worker threads, the caller may release the GIL around it.
+void CopyChunks(char * dst, Py_ssize_t dst_step, const char * src, Py_ssize_t src_step, Py_ssize_t chunk_size, Py_ssize_t count);
@@ -0,0 +1,125 @@
+#include "Types.hpp"
+
+#include <climits>
+
+Py_ssize_t MGLCompressed_Size(MGLDataType * data_type, int components, int width, int height, int depth) {
+	Py_ssize_t blocks_x = (width + 3) / 4;
+	Py_ssize_t blocks_y = (height + 3) / 4;
+	return blocks_x * blocks_y * (depth > 1 ? depth : 1) * data_type->block_size[components];
+}
+
+bool MGLCompressed_CheckBlocks(int x, int y, int width, int height, int level_width, int level_height) {
+	// Partial blocks are only allowed along the right and bottom edges of the level.
+	bool aligned = x % 4 == 0 && y % 4 == 0;
+	aligned = aligned && (width % 4 == 0 || x + width == level_width);
+	aligned = aligned && (height % 4 == 0 || y + height == level_height);
+
+	if (!aligned) {
+		MGLError_Set("the viewport (%d, %d, %d, %d) is not aligned to the 4x4 blocks", x, y, width, height);
+		return false;
+	}
+
+	return true;
+}
+
+bool MGLCompressed_Write(const GLMethods & gl, int target, int level, int x, int y, int z, int width, int height, int depth, int internal_format, bool define, PyObject * data, Py_ssize_t expected_size) {
+	if (expected_size > INT_MAX) {
+		MGLError_Set("the compressed image is too large");
+		return false;
+	}
+
+	Py_buffer buffer_view;
+	const void * blocks = 0;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("the buffer is too small %zd < %zd", buffer->size, expected_size);
+			return false;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+
+	} else if (data != Py_None) {
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) must be a contiguous buffer", Py_TYPE(data)->tp_name);
+			return false;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return false;
+		}
+
+		blocks = buffer_view.buf;
+	}
+
+	int image_size = (int)expected_size;
+
+	if (define && depth) {
+		gl.CompressedTexImage3D(target, level, internal_format, width, height, depth, 0, image_size, blocks);
+	} else if (define) {
+		gl.CompressedTexImage2D(target, level, internal_format, width, height, 0, image_size, blocks);
+	} else if (depth) {
+		gl.CompressedTexSubImage3D(target, level, x, y, z, width, height, depth, internal_format, image_size, blocks);
+	} else {
+		gl.CompressedTexSubImage2D(target, level, x, y, width, height, internal_format, image_size, blocks);
+	}
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	} else if (data != Py_None) {
+		PyBuffer_Release(&buffer_view);
+	}
+
+	return true;
+}
+
+PyObject * MGLCompressed_Read(const GLMethods & gl, int target, int level, PyObject * out, Py_ssize_t write_offset, Py_ssize_t expected_size) {
+	if (out == Py_None) {
+		PyObject * result = PyBytes_FromStringAndSize(0, expected_size);
+		gl.GetCompressedTexImage(target, level, PyBytes_AS_STRING(result));
+		return result;
+	}
+
+	if (write_offset < 0) {
+		MGLError_Set("invalid write_offset = %zd", write_offset);
+		return 0;
+	}
+
+	if (Py_TYPE(out) == &MGLBuffer_Type) {
+		MGLBuffer * buffer = (MGLBuffer *)out;
+
+		if (buffer->size < write_offset + expected_size) {
+			MGLError_Set("the buffer is too small");
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, buffer->buffer_obj);
+		gl.GetCompressedTexImage(target, level, (void *)write_offset);
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		Py_RETURN_NONE;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(out, &buffer_view, PyBUF_WRITABLE);
+	if (get_buffer < 0) {
+		MGLError_Set("the buffer (%s) does not support buffer interface", Py_TYPE(out)->tp_name);
+		return 0;
+	}
+
+	if (buffer_view.len < write_offset + expected_size) {
+		MGLError_Set("the buffer is too small");
+		PyBuffer_Release(&buffer_view);
+		return 0;
+	}
+
+	gl.GetCompressedTexImage(target, level, (char *)buffer_view.buf + write_offset);
+
+	PyBuffer_Release(&buffer_view);
+	Py_RETURN_NONE;
+}
@@ -166,6 +166,7 @@ PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args) {
 		mglo->size = size;
 		mglo->program_obj = program_obj;
 		mglo->gl = &gl;
+		MGLUniformBlock_Complete(mglo, gl);
 
 		PyObject * item = PyTuple_New(4);
 		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
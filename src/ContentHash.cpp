@@ -0,0 +1,129 @@
+#include "Types.hpp"
+
+#include <cstring>
+#include <stdint.h>
+
+// XXH64 of the xxHash family, fast enough to hash uploads before they reach the driver.
+
+static const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME64_3 = 0x165667B19E3779F9ULL;
+static const uint64_t PRIME64_4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64_t PRIME64_5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t Rotl64(uint64_t x, int r) {
+	return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t Read64(const unsigned char * ptr) {
+	uint64_t value;
+	memcpy(&value, ptr, 8);
+	return value;
+}
+
+inline uint32_t Read32(const unsigned char * ptr) {
+	uint32_t value;
+	memcpy(&value, ptr, 4);
+	return value;
+}
+
+inline uint64_t XXH64_round(uint64_t acc, uint64_t input) {
+	acc += input * PRIME64_2;
+	acc = Rotl64(acc, 31);
+	return acc * PRIME64_1;
+}
+
+inline uint64_t XXH64_merge(uint64_t acc, uint64_t value) {
+	acc ^= XXH64_round(0, value);
+	return acc * PRIME64_1 + PRIME64_4;
+}
+
+uint64_t XXH64(const unsigned char * ptr, Py_ssize_t len, uint64_t seed) {
+	const unsigned char * end = ptr + len;
+	uint64_t h64;
+
+	if (len >= 32) {
+		uint64_t v1 = seed + PRIME64_1 + PRIME64_2;
+		uint64_t v2 = seed + PRIME64_2;
+		uint64_t v3 = seed;
+		uint64_t v4 = seed - PRIME64_1;
+
+		const unsigned char * limit = end - 32;
+
+		do {
+			v1 = XXH64_round(v1, Read64(ptr));
+			v2 = XXH64_round(v2, Read64(ptr + 8));
+			v3 = XXH64_round(v3, Read64(ptr + 16));
+			v4 = XXH64_round(v4, Read64(ptr + 24));
+			ptr += 32;
+		} while (ptr <= limit);
+
+		h64 = Rotl64(v1, 1) + Rotl64(v2, 7) + Rotl64(v3, 12) + Rotl64(v4, 18);
+		h64 = XXH64_merge(h64, v1);
+		h64 = XXH64_merge(h64, v2);
+		h64 = XXH64_merge(h64, v3);
+		h64 = XXH64_merge(h64, v4);
+	} else {
+		h64 = seed + PRIME64_5;
+	}
+
+	h64 += (uint64_t)len;
+
+	while (ptr + 8 <= end) {
+		h64 ^= XXH64_round(0, Read64(ptr));
+		h64 = Rotl64(h64, 27) * PRIME64_1 + PRIME64_4;
+		ptr += 8;
+	}
+
+	if (ptr + 4 <= end) {
+		h64 ^= (uint64_t)Read32(ptr) * PRIME64_1;
+		h64 = Rotl64(h64, 23) * PRIME64_2 + PRIME64_3;
+		ptr += 4;
+	}
+
+	while (ptr < end) {
+		h64 ^= (*ptr++) * PRIME64_5;
+		h64 = Rotl64(h64, 11) * PRIME64_1;
+	}
+
+	h64 ^= h64 >> 33;
+	h64 *= PRIME64_2;
+	h64 ^= h64 >> 29;
+	h64 *= PRIME64_3;
+	h64 ^= h64 >> 32;
+	return h64;
+}
+
+PyObject * content_hash(PyObject * self, PyObject * args) {
+	PyObject * data;
+	unsigned long long seed;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OK",
+		&data,
+		&seed
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+
+	int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_C_CONTIGUOUS);
+	if (get_buffer < 0) {
+		PyErr_Clear();
+		MGLError_Set("data (%s) must be a contiguous buffer", Py_TYPE(data)->tp_name);
+		return 0;
+	}
+
+	uint64_t hash;
+
+	Py_BEGIN_ALLOW_THREADS
+	hash = XXH64((const unsigned char *)buffer_view.buf, buffer_view.len, seed);
+	Py_END_ALLOW_THREADS
+
+	PyBuffer_Release(&buffer_view);
+	return PyLong_FromUnsignedLongLong(hash);
+}
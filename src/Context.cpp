@@ -431,10 +431,13 @@ PyObject * MGLContext_clear_samplers(MGLContext * self, PyObject * args) {
 }
 
 PyObject * MGLContext_buffer(MGLContext * self, PyObject * args);
+PyObject * MGLContext_stream_buffer(MGLContext * self, PyObject * args);
+PyObject * MGLContext_buffer_arena(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args);
+PyObject * MGLContext_texture_buffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args);
 PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args);
 PyObject * MGLContext_program(MGLContext * self, PyObject * args);
@@ -442,6 +445,7 @@ PyObject * MGLContext_framebuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_renderbuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_depth_renderbuffer(MGLContext * self, PyObject * args);
 PyObject * MGLContext_compute_shader(MGLContext * self, PyObject * args);
+PyObject * MGLContext_fence(MGLContext * self, PyObject * args);
 PyObject * MGLContext_query(MGLContext * self, PyObject * args);
 PyObject * MGLContext_scope(MGLContext * self, PyObject * args);
 PyObject * MGLContext_sampler(MGLContext * self, PyObject * args);
@@ -463,10 +467,13 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"clear_samplers", (PyCFunction)MGLContext_clear_samplers, METH_VARARGS, 0},
 
 	{"buffer", (PyCFunction)MGLContext_buffer, METH_VARARGS, 0},
+	{"stream_buffer", (PyCFunction)MGLContext_stream_buffer, METH_VARARGS, 0},
+	{"buffer_arena", (PyCFunction)MGLContext_buffer_arena, METH_VARARGS, 0},
 	{"texture", (PyCFunction)MGLContext_texture, METH_VARARGS, 0},
 	{"texture3d", (PyCFunction)MGLContext_texture3d, METH_VARARGS, 0},
 	{"texture_array", (PyCFunction)MGLContext_texture_array, METH_VARARGS, 0},
 	{"texture_cube", (PyCFunction)MGLContext_texture_cube, METH_VARARGS, 0},
+	{"texture_buffer", (PyCFunction)MGLContext_texture_buffer, METH_VARARGS, 0},
 	{"depth_texture", (PyCFunction)MGLContext_depth_texture, METH_VARARGS, 0},
 	{"vertex_array", (PyCFunction)MGLContext_vertex_array, METH_VARARGS, 0},
 	{"program", (PyCFunction)MGLContext_program, METH_VARARGS, 0},
@@ -475,6 +482,7 @@ PyMethodDef MGLContext_tp_methods[] = {
 	{"renderbuffer", (PyCFunction)MGLContext_renderbuffer, METH_VARARGS, 0},
 	{"depth_renderbuffer", (PyCFunction)MGLContext_depth_renderbuffer, METH_VARARGS, 0},
 	{"compute_shader", (PyCFunction)MGLContext_compute_shader, METH_VARARGS, 0},
+	{"fence", (PyCFunction)MGLContext_fence, METH_VARARGS, 0},
 	{"query", (PyCFunction)MGLContext_query, METH_VARARGS, 0},
 	{"scope", (PyCFunction)MGLContext_scope, METH_VARARGS, 0},
 	{"sampler", (PyCFunction)MGLContext_sampler, METH_VARARGS, 0},
@@ -1382,6 +1390,12 @@ void MGLContext_Initialize(MGLContext * self) {
 	self->max_anisotropy = 0.0;
 	gl.GetFloatv(GL_MAX_TEXTURE_MAX_ANISOTROPY, (GLfloat *)&self->max_anisotropy);
 
+	self->uniform_buffer_offset_alignment = 0;
+	gl.GetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, (GLint *)&self->uniform_buffer_offset_alignment);
+	if (self->uniform_buffer_offset_alignment < 1) {
+		self->uniform_buffer_offset_alignment = 1;
+	}
+
 	int bound_framebuffer = 0;
 	gl.GetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &bound_framebuffer);
 
@@ -0,0 +1,552 @@
+#include "Convert.hpp"
+
+#include "OpenGL.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MGL_CONVERT_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(MGL_CONVERT_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MGL_CONVERT_AVX2
+#include <immintrin.h>
+#endif
+
+bool ConvertType_FromDtype(ConvertType * type, const char * dtype) {
+	if (!dtype[0] || !dtype[1] || dtype[2]) {
+		return false;
+	}
+
+	type->size = dtype[1] - '0';
+	type->normalize = false;
+
+	switch (dtype[0] * 256 + dtype[1]) {
+		case 'f' * 256 + '1':
+			type->type = GL_UNSIGNED_BYTE;
+			type->normalize = true;
+			return true;
+
+		case 'f' * 256 + '2':
+			type->type = GL_HALF_FLOAT;
+			return true;
+
+		case 'f' * 256 + '4':
+			type->type = GL_FLOAT;
+			return true;
+
+		case 'f' * 256 + '8':
+			type->type = GL_DOUBLE;
+			return true;
+
+		case 'i' * 256 + '1':
+			type->type = GL_BYTE;
+			return true;
+
+		case 'i' * 256 + '2':
+			type->type = GL_SHORT;
+			return true;
+
+		case 'i' * 256 + '4':
+			type->type = GL_INT;
+			return true;
+
+		case 'u' * 256 + '1':
+			type->type = GL_UNSIGNED_BYTE;
+			return true;
+
+		case 'u' * 256 + '2':
+			type->type = GL_UNSIGNED_SHORT;
+			return true;
+
+		case 'u' * 256 + '4':
+			type->type = GL_UNSIGNED_INT;
+			return true;
+	}
+
+	return false;
+}
+
+// Round to nearest even, overflow becomes infinity.
+inline unsigned short FloatToHalf(float value) {
+	const unsigned f32_infinity = 255u << 23;
+	const unsigned f16_max = (127u + 16u) << 23;
+	const unsigned denorm_magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+	unsigned bits;
+	memcpy(&bits, &value, 4);
+
+	unsigned sign = bits & 0x80000000u;
+	bits ^= sign;
+
+	unsigned short res;
+
+	if (bits >= f16_max) {
+		res = bits > f32_infinity ? 0x7e00 : 0x7c00;
+	} else if (bits < (113u << 23)) {
+		float magic, abs;
+		memcpy(&magic, &denorm_magic, 4);
+		memcpy(&abs, &bits, 4);
+		abs += magic;
+		memcpy(&bits, &abs, 4);
+		res = (unsigned short)(bits - denorm_magic);
+	} else {
+		unsigned odd = (bits >> 13) & 1;
+		bits += ((unsigned)(15 - 127) << 23) + 0xfff + odd;
+		res = (unsigned short)(bits >> 13);
+	}
+
+	return res | (unsigned short)(sign >> 16);
+}
+
+inline float HalfToFloat(unsigned short value) {
+	const unsigned shifted_exp = 0x7c00u << 13;
+	const unsigned denorm_magic = 113u << 23;
+
+	unsigned bits = (value & 0x7fffu) << 13;
+	unsigned exp = bits & shifted_exp;
+	bits += (127u - 15u) << 23;
+
+	if (exp == shifted_exp) {
+		bits += (128u - 16u) << 23;
+	} else if (!exp) {
+		float magic, res;
+		bits += 1u << 23;
+		memcpy(&magic, &denorm_magic, 4);
+		memcpy(&res, &bits, 4);
+		res -= magic;
+		memcpy(&bits, &res, 4);
+	}
+
+	bits |= (unsigned)(value & 0x8000u) << 16;
+
+	float res;
+	memcpy(&res, &bits, 4);
+	return res;
+}
+
+inline double Snorm(double value) {
+	return value > -1.0 ? value : -1.0;
+}
+
+inline double ReadValue(const char * src, const ConvertType & type) {
+	switch (type.type) {
+		case GL_HALF_FLOAT: return HalfToFloat(*(const unsigned short *)src);
+		case GL_FLOAT: return *(const float *)src;
+		case GL_DOUBLE: return *(const double *)src;
+		case GL_BYTE: return type.normalize ? Snorm(*(const signed char *)src / 127.0) : *(const signed char *)src;
+		case GL_SHORT: return type.normalize ? Snorm(*(const short *)src / 32767.0) : *(const short *)src;
+		case GL_INT: return *(const int *)src;
+		case GL_UNSIGNED_BYTE: return type.normalize ? *(const unsigned char *)src / 255.0 : *(const unsigned char *)src;
+		case GL_UNSIGNED_SHORT: return *(const unsigned short *)src;
+		case GL_UNSIGNED_INT: return *(const unsigned *)src;
+	}
+	return 0.0;
+}
+
+inline double Clamp(double value, double low, double high) {
+	// NaN fails both comparisons and becomes the lower bound.
+	return value >= low ? (value <= high ? value : high) : low;
+}
+
+inline void WriteValue(char * dst, const ConvertType & type, double value) {
+	switch (type.type) {
+		case GL_HALF_FLOAT: *(unsigned short *)dst = FloatToHalf((float)value); break;
+		case GL_FLOAT: *(float *)dst = (float)value; break;
+		case GL_DOUBLE: *(double *)dst = value; break;
+		case GL_BYTE:
+			if (type.normalize) {
+				*(signed char *)dst = (signed char)nearbyint(Clamp(value, -1.0, 1.0) * 127.0);
+			} else {
+				*(signed char *)dst = (signed char)Clamp(value, -128.0, 127.0);
+			}
+			break;
+		case GL_SHORT:
+			if (type.normalize) {
+				*(short *)dst = (short)nearbyint(Clamp(value, -1.0, 1.0) * 32767.0);
+			} else {
+				*(short *)dst = (short)Clamp(value, -32768.0, 32767.0);
+			}
+			break;
+		case GL_INT: *(int *)dst = (int)Clamp(value, -2147483648.0, 2147483647.0); break;
+		case GL_UNSIGNED_SHORT: *(unsigned short *)dst = (unsigned short)Clamp(value, 0.0, 65535.0); break;
+		case GL_UNSIGNED_INT: *(unsigned *)dst = (unsigned)Clamp(value, 0.0, 4294967295.0); break;
+		case GL_UNSIGNED_BYTE:
+			if (type.normalize) {
+				*(unsigned char *)dst = (unsigned char)(Clamp(value, 0.0, 1.0) * 255.0 + 0.5);
+			} else {
+				*(unsigned char *)dst = (unsigned char)Clamp(value, 0.0, 255.0);
+			}
+			break;
+	}
+}
+
+void ConvertGeneric(char * dst, const ConvertType & dst_type, const char * src, const ConvertType & src_type, Py_ssize_t count) {
+	for (Py_ssize_t i = 0; i < count; ++i) {
+		WriteValue(dst, dst_type, ReadValue(src, src_type));
+		dst += dst_type.size;
+		src += src_type.size;
+	}
+}
+
+// Packs four values into 10, 10, 10 and 2 bits, normalized components are rounded to nearest even.
+inline unsigned PackValues(const double * value, bool is_signed) {
+	unsigned res = 0;
+	for (int i = 0; i < 4; ++i) {
+		double max = i < 3 ? (is_signed ? 511.0 : 1023.0) : (is_signed ? 1.0 : 3.0);
+		double scaled = nearbyint(Clamp(value[i], is_signed ? -1.0 : 0.0, 1.0) * max);
+		res |= ((unsigned)(int)scaled & (i < 3 ? 0x3ffu : 0x3u)) << (i * 10);
+	}
+	return res;
+}
+
+inline void UnpackValues(double * value, unsigned packed, bool is_signed) {
+	for (int i = 0; i < 4; ++i) {
+		int bits = i < 3 ? 10 : 2;
+		unsigned field = (packed >> (i * 10)) & ((1u << bits) - 1);
+		if (is_signed) {
+			int signed_field = (int)(field << (32 - bits)) >> (32 - bits);
+			value[i] = Snorm(signed_field / (double)((1 << (bits - 1)) - 1));
+		} else {
+			value[i] = field / (double)((1 << bits) - 1);
+		}
+	}
+}
+
+inline bool IsPacked(const ConvertType & type) {
+	return type.type == GL_INT_2_10_10_10_REV || type.type == GL_UNSIGNED_INT_2_10_10_10_REV;
+}
+
+// Packed types have a size of one byte per component so count stays a number of components.
+void ConvertPacked(char * dst, const ConvertType & dst_type, const char * src, const ConvertType & src_type, Py_ssize_t count) {
+	double value[4];
+	for (Py_ssize_t i = 0; i < count; i += 4) {
+		if (IsPacked(src_type)) {
+			UnpackValues(value, *(const unsigned *)src, src_type.type == GL_INT_2_10_10_10_REV);
+			src += 4;
+		} else {
+			for (int j = 0; j < 4; ++j) {
+				value[j] = ReadValue(src, src_type);
+				src += src_type.size;
+			}
+		}
+		if (IsPacked(dst_type)) {
+			*(unsigned *)dst = PackValues(value, dst_type.type == GL_INT_2_10_10_10_REV);
+			dst += 4;
+		} else {
+			for (int j = 0; j < 4; ++j) {
+				WriteValue(dst, dst_type, value[j]);
+				dst += dst_type.size;
+			}
+		}
+	}
+}
+
+inline float ClampFloat(float value, float low, float high) {
+	return value >= low ? (value <= high ? value : high) : low;
+}
+
+void EncodeNormals(unsigned * dst, const float * src, Py_ssize_t vertices, int components) {
+	Py_ssize_t i = 0;
+#ifdef MGL_CONVERT_SSE2
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 minus_one = _mm_set1_ps(-1.0f);
+	const __m128 xyz_max = _mm_set1_ps(511.0f);
+	const __m128i xyz_mask = _mm_set1_epi32(0x3ff);
+	const __m128i w_mask = _mm_set1_epi32(0x3);
+	for (; i + 4 <= vertices; i += 4) {
+		const float * ptr = src + i * components;
+		__m128 x, y, z, w;
+		if (components == 4) {
+			x = _mm_loadu_ps(ptr);
+			y = _mm_loadu_ps(ptr + 4);
+			z = _mm_loadu_ps(ptr + 8);
+			w = _mm_loadu_ps(ptr + 12);
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+		} else {
+			x = _mm_setr_ps(ptr[0], ptr[3], ptr[6], ptr[9]);
+			y = _mm_setr_ps(ptr[1], ptr[4], ptr[7], ptr[10]);
+			z = _mm_setr_ps(ptr[2], ptr[5], ptr[8], ptr[11]);
+			w = _mm_setzero_ps();
+		}
+		// The operand order maps NaN to -1 like the scalar clamp.
+		x = _mm_max_ps(_mm_min_ps(one, x), minus_one);
+		y = _mm_max_ps(_mm_min_ps(one, y), minus_one);
+		z = _mm_max_ps(_mm_min_ps(one, z), minus_one);
+		w = _mm_max_ps(_mm_min_ps(one, w), minus_one);
+		__m128i ix = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(x, xyz_max)), xyz_mask);
+		__m128i iy = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(y, xyz_max)), xyz_mask);
+		__m128i iz = _mm_and_si128(_mm_cvtps_epi32(_mm_mul_ps(z, xyz_max)), xyz_mask);
+		__m128i iw = _mm_and_si128(_mm_cvtps_epi32(w), w_mask);
+		__m128i res = _mm_or_si128(_mm_or_si128(ix, _mm_slli_epi32(iy, 10)), _mm_or_si128(_mm_slli_epi32(iz, 20), _mm_slli_epi32(iw, 30)));
+		_mm_storeu_si128((__m128i *)(dst + i), res);
+	}
+#endif
+	// The tail scales and rounds in single precision like the vector path, halfway cases must not depend on the vertex count.
+	for (; i < vertices; ++i) {
+		const float * ptr = src + i * components;
+		unsigned x = (unsigned)(int)nearbyintf(ClampFloat(ptr[0], -1.0f, 1.0f) * 511.0f) & 0x3ffu;
+		unsigned y = (unsigned)(int)nearbyintf(ClampFloat(ptr[1], -1.0f, 1.0f) * 511.0f) & 0x3ffu;
+		unsigned z = (unsigned)(int)nearbyintf(ClampFloat(ptr[2], -1.0f, 1.0f) * 511.0f) & 0x3ffu;
+		unsigned w = (unsigned)(int)nearbyintf(ClampFloat(components == 4 ? ptr[3] : 0.0f, -1.0f, 1.0f)) & 0x3u;
+		dst[i] = x | y << 10 | z << 20 | w << 30;
+	}
+}
+
+void QuantizeBounds(float * offset, float * scale, const float * src, Py_ssize_t vertices, int components) {
+	float low[4];
+	float high[4];
+
+	for (int c = 0; c < components; ++c) {
+		low[c] = vertices ? src[c] : 0.0f;
+		high[c] = vertices ? src[c] : 0.0f;
+	}
+
+	Py_ssize_t count = vertices * components;
+	Py_ssize_t i = 0;
+#ifdef MGL_CONVERT_SSE2
+	// Twelve floats hold a whole number of vertices for one to four components.
+	if (count >= 12) {
+		__m128 lo[3] = {_mm_loadu_ps(src), _mm_loadu_ps(src + 4), _mm_loadu_ps(src + 8)};
+		__m128 hi[3] = {lo[0], lo[1], lo[2]};
+		for (i = 12; i + 12 <= count; i += 12) {
+			for (int k = 0; k < 3; ++k) {
+				__m128 value = _mm_loadu_ps(src + i + k * 4);
+				lo[k] = _mm_min_ps(lo[k], value);
+				hi[k] = _mm_max_ps(hi[k], value);
+			}
+		}
+		float lanes_lo[12];
+		float lanes_hi[12];
+		for (int k = 0; k < 3; ++k) {
+			_mm_storeu_ps(lanes_lo + k * 4, lo[k]);
+			_mm_storeu_ps(lanes_hi + k * 4, hi[k]);
+		}
+		for (int k = 0; k < 12; ++k) {
+			int c = k % components;
+			low[c] = lanes_lo[k] < low[c] ? lanes_lo[k] : low[c];
+			high[c] = lanes_hi[k] > high[c] ? lanes_hi[k] : high[c];
+		}
+	}
+#endif
+	for (; i < count; ++i) {
+		int c = (int)(i % components);
+		low[c] = src[i] < low[c] ? src[i] : low[c];
+		high[c] = src[i] > high[c] ? src[i] : high[c];
+	}
+
+	for (int c = 0; c < components; ++c) {
+		offset[c] = (low[c] + high[c]) * 0.5f;
+		scale[c] = (high[c] - low[c]) * 0.5f;
+		if (!(scale[c] > 0.0f)) {
+			scale[c] = 1.0f;
+		}
+	}
+}
+
+void QuantizeValues(float * dst, const float * src, Py_ssize_t count, const float * offset, const float * scale, int components) {
+	float inv_scale[4];
+	for (int c = 0; c < components; ++c) {
+		inv_scale[c] = 1.0f / scale[c];
+	}
+
+	Py_ssize_t i = 0;
+#ifdef MGL_CONVERT_SSE2
+	float lanes_offset[12];
+	float lanes_scale[12];
+	for (int k = 0; k < 12; ++k) {
+		lanes_offset[k] = offset[k % components];
+		lanes_scale[k] = inv_scale[k % components];
+	}
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 minus_one = _mm_set1_ps(-1.0f);
+	for (; i + 12 <= count; i += 12) {
+		for (int k = 0; k < 3; ++k) {
+			__m128 value = _mm_sub_ps(_mm_loadu_ps(src + i + k * 4), _mm_loadu_ps(lanes_offset + k * 4));
+			value = _mm_mul_ps(value, _mm_loadu_ps(lanes_scale + k * 4));
+			_mm_storeu_ps(dst + i + k * 4, _mm_max_ps(_mm_min_ps(one, value), minus_one));
+		}
+	}
+#endif
+	for (; i < count; ++i) {
+		int c = (int)(i % components);
+		dst[i] = ClampFloat((src[i] - offset[c]) * inv_scale[c], -1.0f, 1.0f);
+	}
+}
+
+void ConvertF32ToSnorm16(short * dst, const float * src, Py_ssize_t count) {
+	Py_ssize_t i = 0;
+#ifdef MGL_CONVERT_SSE2
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 minus_one = _mm_set1_ps(-1.0f);
+	const __m128 max = _mm_set1_ps(32767.0f);
+	for (; i + 8 <= count; i += 8) {
+		__m128 lo = _mm_max_ps(_mm_min_ps(one, _mm_loadu_ps(src + i)), minus_one);
+		__m128 hi = _mm_max_ps(_mm_min_ps(one, _mm_loadu_ps(src + i + 4)), minus_one);
+		__m128i ilo = _mm_cvtps_epi32(_mm_mul_ps(lo, max));
+		__m128i ihi = _mm_cvtps_epi32(_mm_mul_ps(hi, max));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(ilo, ihi));
+	}
+#endif
+	for (; i < count; ++i) {
+		dst[i] = (short)nearbyintf(ClampFloat(src[i], -1.0f, 1.0f) * 32767.0f);
+	}
+}
+
+void ConvertF64ToF32(float * dst, const double * src, Py_ssize_t count) {
+	Py_ssize_t i = 0;
+#ifdef MGL_CONVERT_SSE2
+	for (; i + 4 <= count; i += 4) {
+		__m128 lo = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+		__m128 hi = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+		_mm_storeu_ps(dst + i, _mm_movelh_ps(lo, hi));
+	}
+#endif
+	for (; i < count; ++i) {
+		dst[i] = (float)src[i];
+	}
+}
+
+void ConvertF32ToF16(unsigned short * dst, const float * src, Py_ssize_t count) {
+	for (Py_ssize_t i = 0; i < count; ++i) {
+		dst[i] = FloatToHalf(src[i]);
+	}
+}
+
+void ConvertF16ToF32(float * dst, const unsigned short * src, Py_ssize_t count) {
+	for (Py_ssize_t i = 0; i < count; ++i) {
+		dst[i] = HalfToFloat(src[i]);
+	}
+}
+
+void ConvertI32ToI16(short * dst, const int * src, Py_ssize_t count) {
+	Py_ssize_t i = 0;
+#ifdef MGL_CONVERT_SSE2
+	for (; i + 8 <= count; i += 8) {
+		__m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 4));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packs_epi32(lo, hi));
+	}
+#endif
+	for (; i < count; ++i) {
+		dst[i] = (short)(src[i] < -32768 ? -32768 : (src[i] > 32767 ? 32767 : src[i]));
+	}
+}
+
+void ConvertI16ToU8(unsigned char * dst, const short * src, Py_ssize_t count) {
+	Py_ssize_t i = 0;
+#ifdef MGL_CONVERT_SSE2
+	for (; i + 16 <= count; i += 16) {
+		__m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+		__m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 8));
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(lo, hi));
+	}
+#endif
+	for (; i < count; ++i) {
+		dst[i] = (unsigned char)(src[i] < 0 ? 0 : (src[i] > 255 ? 255 : src[i]));
+	}
+}
+
+#ifdef MGL_CONVERT_AVX2
+
+__attribute__((target("avx2,f16c")))
+void ConvertF64ToF32AVX2(float * dst, const double * src, Py_ssize_t count) {
+	Py_ssize_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		_mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+	}
+	ConvertF64ToF32(dst + i, src + i, count - i);
+}
+
+__attribute__((target("avx2,f16c")))
+void ConvertF32ToF16AVX2(unsigned short * dst, const float * src, Py_ssize_t count) {
+	Py_ssize_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm_storeu_si128((__m128i *)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+	}
+	ConvertF32ToF16(dst + i, src + i, count - i);
+}
+
+__attribute__((target("avx2,f16c")))
+void ConvertF16ToF32AVX2(float * dst, const unsigned short * src, Py_ssize_t count) {
+	Py_ssize_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(src + i))));
+	}
+	ConvertF16ToF32(dst + i, src + i, count - i);
+}
+
+#endif
+
+struct ConvertProcs {
+	void (* f64_to_f32)(float * dst, const double * src, Py_ssize_t count);
+	void (* f32_to_f16)(unsigned short * dst, const float * src, Py_ssize_t count);
+	void (* f16_to_f32)(float * dst, const unsigned short * src, Py_ssize_t count);
+};
+
+ConvertProcs SelectConvertProcs() {
+	ConvertProcs procs = {ConvertF64ToF32, ConvertF32ToF16, ConvertF16ToF32};
+
+#ifdef MGL_CONVERT_AVX2
+	// Every CPU with AVX2 also has F16C.
+	if (__builtin_cpu_supports("avx2")) {
+		procs.f64_to_f32 = ConvertF64ToF32AVX2;
+		procs.f32_to_f16 = ConvertF32ToF16AVX2;
+		procs.f16_to_f32 = ConvertF16ToF32AVX2;
+	}
+#endif
+
+	return procs;
+}
+
+void ConvertValues(char * dst, const ConvertType & dst_type, const char * src, const ConvertType & src_type, Py_ssize_t count) {
+	static ConvertProcs procs = SelectConvertProcs();
+
+	if (dst_type.type == src_type.type && dst_type.normalize == src_type.normalize) {
+		memcpy(dst, src, count * src_type.size);
+		return;
+	}
+
+	if (IsPacked(dst_type) || IsPacked(src_type)) {
+		if (src_type.type == GL_FLOAT && dst_type.type == GL_INT_2_10_10_10_REV) {
+			EncodeNormals((unsigned *)dst, (const float *)src, count / 4, 4);
+			return;
+		}
+		ConvertPacked(dst, dst_type, src, src_type, count);
+		return;
+	}
+
+	if (src_type.type == GL_FLOAT && dst_type.type == GL_SHORT && dst_type.normalize) {
+		ConvertF32ToSnorm16((short *)dst, (const float *)src, count);
+		return;
+	}
+
+	if (src_type.type == GL_DOUBLE && dst_type.type == GL_FLOAT) {
+		procs.f64_to_f32((float *)dst, (const double *)src, count);
+		return;
+	}
+
+	if (src_type.type == GL_FLOAT && dst_type.type == GL_HALF_FLOAT) {
+		procs.f32_to_f16((unsigned short *)dst, (const float *)src, count);
+		return;
+	}
+
+	if (src_type.type == GL_HALF_FLOAT && dst_type.type == GL_FLOAT) {
+		procs.f16_to_f32((float *)dst, (const unsigned short *)src, count);
+		return;
+	}
+
+	if (src_type.type == GL_INT && dst_type.type == GL_SHORT && !dst_type.normalize) {
+		ConvertI32ToI16((short *)dst, (const int *)src, count);
+		return;
+	}
+
+	if (src_type.type == GL_SHORT && dst_type.type == GL_UNSIGNED_BYTE && !dst_type.normalize) {
+		ConvertI16ToU8((unsigned char *)dst, (const short *)src, count);
+		return;
+	}
+
+	ConvertGeneric(dst, dst_type, src, src_type, count);
+}
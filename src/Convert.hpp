@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Python.hpp"
+
+struct ConvertType {
+	int type;
+	int size;
+	bool normalize;
+};
+
+// Parses a dtype such as 'f4' or 'u2', 'f1' is a normalized unsigned byte like in the buffer formats.
+bool ConvertType_FromDtype(ConvertType * type, const char * dtype);
+
+// Converts count contiguous values, floats are clamped to the range of integer destinations.
+void ConvertValues(char * dst, const ConvertType & dst_type, const char * src, const ConvertType & src_type, Py_ssize_t count);
+
+// Packs unit vectors of 3 or 4 floats into signed normalized 2_10_10_10 words, a missing w is zero.
+void EncodeNormals(unsigned * dst, const float * src, Py_ssize_t vertices, int components);
+
+// Finds the center and the half extent of every component, flat components get a scale of one.
+void QuantizeBounds(float * offset, float * scale, const float * src, Py_ssize_t vertices, int components);
+
+// Maps the components into [-1, 1] with (value - offset) / scale.
+void QuantizeValues(float * dst, const float * src, Py_ssize_t count, const float * offset, const float * scale, int components);
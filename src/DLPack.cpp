@@ -0,0 +1,285 @@
+#include "Types.hpp"
+
+#include <stdint.h>
+
+// The DLManagedTensor and DLManagedTensorVersioned of dlpack.h, the layout is part of the DLPack ABI.
+
+struct DLDevice {
+	int device_type;
+	int device_id;
+};
+
+struct DLDataType {
+	uint8_t code;
+	uint8_t bits;
+	uint16_t lanes;
+};
+
+struct DLTensor {
+	void * data;
+	DLDevice device;
+	int ndim;
+	DLDataType dtype;
+	int64_t * shape;
+	int64_t * strides;
+	uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+	DLTensor dl_tensor;
+	void * manager_ctx;
+	void (* deleter)(DLManagedTensor * self);
+};
+
+struct DLPackVersion {
+	uint32_t major;
+	uint32_t minor;
+};
+
+struct DLManagedTensorVersioned {
+	DLPackVersion version;
+	void * manager_ctx;
+	void (* deleter)(DLManagedTensorVersioned * self);
+	uint64_t flags;
+	DLTensor dl_tensor;
+};
+
+enum {
+	kDLInt = 0,
+	kDLUInt = 1,
+	kDLFloat = 2,
+	kDLCPU = 1,
+	DLPACK_FLAG_BITMASK_READ_ONLY = 1,
+};
+
+struct DLPackExport {
+	DLManagedTensor tensor;
+	DLManagedTensorVersioned versioned;
+	Py_buffer view;
+	int64_t * shape;
+};
+
+// The numpy kind of a texture dtype, normalized bytes are exported as unsigned integers.
+char DataType_kind(MGLDataType * data_type) {
+	switch (data_type->gl_type) {
+		case GL_FLOAT:
+		case GL_HALF_FLOAT:
+			return 'f';
+
+		case GL_UNSIGNED_BYTE:
+		case GL_UNSIGNED_SHORT:
+		case GL_UNSIGNED_INT:
+			return 'u';
+
+		default:
+			return 'i';
+	}
+}
+
+PyObject * data_type(PyObject * self, PyObject * args) {
+	const char * dtype;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"s",
+		&dtype
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	char byteorder = data_type->size == 1 ? '|' : (PY_LITTLE_ENDIAN ? '<' : '>');
+	PyObject * typestr = PyUnicode_FromFormat("%c%c%d", byteorder, DataType_kind(data_type), data_type->size);
+	return Py_BuildValue("(Ni)", typestr, data_type->size);
+}
+
+void DLPack_release(DLPackExport * exported) {
+	PyGILState_STATE state = PyGILState_Ensure();
+	PyBuffer_Release(&exported->view);
+	PyGILState_Release(state);
+
+	delete[] exported->shape;
+	delete exported;
+}
+
+void DLPack_deleter(DLManagedTensor * tensor) {
+	DLPack_release((DLPackExport *)tensor->manager_ctx);
+}
+
+void DLPack_versioned_deleter(DLManagedTensorVersioned * tensor) {
+	DLPack_release((DLPackExport *)tensor->manager_ctx);
+}
+
+void DLPack_capsule_destructor(PyObject * capsule) {
+	// Consumers rename the capsule to "used_dltensor" and take over the tensor.
+	if (PyCapsule_IsValid(capsule, "dltensor")) {
+		DLManagedTensor * tensor = (DLManagedTensor *)PyCapsule_GetPointer(capsule, "dltensor");
+		tensor->deleter(tensor);
+	}
+}
+
+void DLPack_versioned_capsule_destructor(PyObject * capsule) {
+	if (PyCapsule_IsValid(capsule, "dltensor_versioned")) {
+		DLManagedTensorVersioned * tensor = (DLManagedTensorVersioned *)PyCapsule_GetPointer(capsule, "dltensor_versioned");
+		tensor->deleter(tensor);
+	}
+}
+
+PyObject * dlpack(PyObject * self, PyObject * args) {
+	PyObject * data;
+	const char * dtype;
+	PyObject * shape;
+	PyObject * strides;
+	int versioned;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OsO!Op",
+		&data,
+		&dtype,
+		&PyTuple_Type,
+		&shape,
+		&strides,
+		&versioned
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+
+	if (!data_type) {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	int ndim = (int)PyTuple_GET_SIZE(shape);
+
+	if (ndim < 1 || ndim > 32) {
+		MGLError_Set("invalid shape");
+		return 0;
+	}
+
+	if (strides != Py_None && (!PyTuple_Check(strides) || PyTuple_GET_SIZE(strides) != ndim)) {
+		MGLError_Set("the strides must match the shape");
+		return 0;
+	}
+
+	int64_t * dims = new int64_t[ndim * 2];
+	int64_t * elements = dims + ndim;
+
+	// Default strides are C contiguous, DLPack strides are counted in elements.
+	int64_t contiguous = 1;
+
+	for (int i = ndim - 1; i >= 0; --i) {
+		dims[i] = PyLong_AsLongLong(PyTuple_GET_ITEM(shape, i));
+		elements[i] = contiguous;
+
+		if (strides != Py_None) {
+			int64_t stride = PyLong_AsLongLong(PyTuple_GET_ITEM(strides, i));
+
+			if (stride < 0 || stride % data_type->size) {
+				if (!PyErr_Occurred()) {
+					MGLError_Set("the stride = %lld is not a multiple of the item size = %d", (long long)stride, data_type->size);
+				}
+				delete[] dims;
+				return 0;
+			}
+
+			elements[i] = stride / data_type->size;
+		}
+
+		if (dims[i] < 0) {
+			if (!PyErr_Occurred()) {
+				MGLError_Set("invalid shape");
+			}
+			delete[] dims;
+			return 0;
+		}
+
+		contiguous *= dims[i];
+	}
+
+	DLPackExport * exported = new DLPackExport;
+
+	int get_buffer = PyObject_GetBuffer(data, &exported->view, PyBUF_SIMPLE);
+	if (get_buffer < 0) {
+		MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+		delete exported;
+		delete[] dims;
+		return 0;
+	}
+
+	// Only versioned tensors can mark the memory read only.
+	if (exported->view.readonly && !versioned) {
+		PyErr_Format(PyExc_BufferError, "read only memory requires DLPack 1.0");
+		PyBuffer_Release(&exported->view);
+		delete exported;
+		delete[] dims;
+		return 0;
+	}
+
+	// The last byte addressed by the shape and strides must be inside the buffer.
+	int64_t extent = data_type->size;
+
+	for (int i = 0; i < ndim; ++i) {
+		if (!dims[i]) {
+			extent = 0;
+			break;
+		}
+		extent += (dims[i] - 1) * elements[i] * data_type->size;
+	}
+
+	if (extent > exported->view.len) {
+		MGLError_Set("the shape needs %lld bytes, the data has %zd bytes", (long long)extent, exported->view.len);
+		PyBuffer_Release(&exported->view);
+		delete exported;
+		delete[] dims;
+		return 0;
+	}
+
+	DLTensor & tensor = versioned ? exported->versioned.dl_tensor : exported->tensor.dl_tensor;
+
+	tensor.data = exported->view.buf;
+	tensor.device.device_type = kDLCPU;
+	tensor.device.device_id = 0;
+	tensor.ndim = ndim;
+	tensor.dtype.code = DataType_kind(data_type) == 'f' ? kDLFloat : (DataType_kind(data_type) == 'u' ? kDLUInt : kDLInt);
+	tensor.dtype.bits = (uint8_t)(data_type->size * 8);
+	tensor.dtype.lanes = 1;
+	tensor.shape = dims;
+	tensor.strides = elements;
+	tensor.byte_offset = 0;
+
+	exported->shape = dims;
+
+	PyObject * capsule;
+
+	if (versioned) {
+		exported->versioned.version.major = 1;
+		exported->versioned.version.minor = 0;
+		exported->versioned.manager_ctx = exported;
+		exported->versioned.deleter = DLPack_versioned_deleter;
+		exported->versioned.flags = exported->view.readonly ? DLPACK_FLAG_BITMASK_READ_ONLY : 0;
+		capsule = PyCapsule_New(&exported->versioned, "dltensor_versioned", DLPack_versioned_capsule_destructor);
+	} else {
+		exported->tensor.manager_ctx = exported;
+		exported->tensor.deleter = DLPack_deleter;
+		capsule = PyCapsule_New(&exported->tensor, "dltensor", DLPack_capsule_destructor);
+	}
+
+	if (!capsule) {
+		DLPack_release(exported);
+	}
+
+	return capsule;
+}
@@ -0,0 +1,238 @@
+#include "Types.hpp"
+
+#include <cstdio>
+
+struct DTypeField {
+	PyObject * name;
+	PyObject * dtype;
+	Py_ssize_t offset;
+};
+
+// The buffer format of a single field feeding an attribute, 0 if there is no such format.
+const char * DTypeField_code(char kind, Py_ssize_t size, char shape) {
+	if (kind == 'b') {
+		// Normalizing would turn True into 1/255, bools only feed integer attributes.
+		if (shape == 'f' || shape == 'd') {
+			return 0;
+		}
+		kind = 'u';
+	}
+
+	if (shape == 'd') {
+		return (kind == 'f' && size == 8) ? "f8" : 0;
+	}
+
+	if (shape == 'f') {
+		// Integer fields feeding float attributes are normalized.
+		switch (kind * 16 + (int)size) {
+			case 'f' * 16 + 2: return "f2";
+			case 'f' * 16 + 4: return "f4";
+			case 'f' * 16 + 8: return "f8";
+			case 'u' * 16 + 1: return "f1";
+			case 'i' * 16 + 1: return "n1";
+			case 'i' * 16 + 2: return "n2";
+		}
+		return 0;
+	}
+
+	switch (kind * 16 + (int)size) {
+		case 'u' * 16 + 1: return "u1";
+		case 'u' * 16 + 2: return "u2";
+		case 'u' * 16 + 4: return "u4";
+		case 'i' * 16 + 1: return "i1";
+		case 'i' * 16 + 2: return "i2";
+		case 'i' * 16 + 4: return "i4";
+	}
+	return 0;
+}
+
+// Reads a single character attribute of a dtype, such as kind or byteorder.
+char DType_char(PyObject * dtype, const char * name) {
+	PyObject * value = PyObject_GetAttrString(dtype, name);
+	const char * str = value ? PyUnicode_AsUTF8(value) : 0;
+	char result = str ? str[0] : 0;
+	Py_XDECREF(value);
+	return result;
+}
+
+Py_ssize_t DType_size(PyObject * dtype, const char * name) {
+	PyObject * value = PyObject_GetAttrString(dtype, name);
+	Py_ssize_t result = value ? PyLong_AsSsize_t(value) : -1;
+	Py_XDECREF(value);
+	return result;
+}
+
+PyObject * dtype_format(PyObject * self, PyObject * args) {
+	PyObject * dtype;
+	PyObject * attributes;
+	PyObject * names;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OO!O",
+		&dtype,
+		&PyDict_Type,
+		&attributes,
+		&names
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	PyObject * fields = PyObject_GetAttrString(dtype, "fields");
+	Py_ssize_t itemsize = DType_size(dtype, "itemsize");
+
+	if (!fields || fields == Py_None || itemsize < 1) {
+		PyErr_Clear();
+		Py_XDECREF(fields);
+		MGLError_Set("the dtype must be a numpy structured dtype");
+		return 0;
+	}
+
+	PyObject * items = PyMapping_Items(fields);
+	Py_DECREF(fields);
+
+	if (!items) {
+		return 0;
+	}
+
+	int num_items = (int)PyList_GET_SIZE(items);
+	DTypeField * sorted = new DTypeField[num_items + 1];
+	int num_fields = 0;
+
+	for (int i = 0; i < num_items; ++i) {
+		PyObject * item = PyList_GET_ITEM(items, i);
+		PyObject * name = PyTuple_GET_ITEM(item, 0);
+		PyObject * info = PyTuple_GET_ITEM(item, 1);
+
+		// Titles are listed as fields too, they are skipped.
+		if (PyTuple_GET_SIZE(info) > 2 && PyTuple_GET_ITEM(info, 2) == name) {
+			continue;
+		}
+
+		DTypeField field = {name, PyTuple_GET_ITEM(info, 0), PyLong_AsSsize_t(PyTuple_GET_ITEM(info, 1))};
+
+		int j = num_fields++;
+		while (j && sorted[j - 1].offset > field.offset) {
+			sorted[j] = sorted[j - 1];
+			--j;
+		}
+		sorted[j] = field;
+	}
+
+	if (names != Py_None) {
+		for (int i = 0; i < (int)PyTuple_GET_SIZE(names); ++i) {
+			bool found = false;
+			for (int j = 0; j < num_fields; ++j) {
+				found = found || PyObject_RichCompareBool(sorted[j].name, PyTuple_GET_ITEM(names, i), Py_EQ) == 1;
+			}
+			if (!found) {
+				MGLError_Set("the dtype has no field %R", PyTuple_GET_ITEM(names, i));
+				delete[] sorted;
+				Py_DECREF(items);
+				return 0;
+			}
+		}
+	}
+
+	// Every field takes at most "2147483647f8 " and every gap "2147483647x ".
+	char * format = new char[num_fields * 32 + 32];
+	int length = 0;
+
+	PyObject * matched = PyList_New(0);
+	Py_ssize_t cursor = 0;
+	bool ok = true;
+
+	for (int i = 0; i < num_fields && ok; ++i) {
+		DTypeField & field = sorted[i];
+
+		if (names != Py_None && !PySequence_Contains(names, field.name)) {
+			continue;
+		}
+
+		MGLAttribute * attribute = (MGLAttribute *)PyDict_GetItem(attributes, field.name);
+
+		if (!attribute || Py_TYPE(attribute) != &MGLAttribute_Type) {
+			continue;
+		}
+
+		if (field.offset < cursor) {
+			MGLError_Set("the field %R overlaps the previous field", field.name);
+			ok = false;
+			break;
+		}
+
+		PyObject * base = PyObject_GetAttrString(field.dtype, "base");
+		PyObject * shape = PyObject_GetAttrString(field.dtype, "shape");
+		PyObject * subfields = base ? PyObject_GetAttrString(base, "fields") : 0;
+
+		char kind = base ? DType_char(base, "kind") : 0;
+		char byteorder = base ? DType_char(base, "byteorder") : 0;
+		Py_ssize_t size = base ? DType_size(base, "itemsize") : -1;
+		Py_ssize_t field_size = DType_size(field.dtype, "itemsize");
+
+		Py_ssize_t count = 1;
+		for (int k = 0; shape && k < (int)PyTuple_GET_SIZE(shape); ++k) {
+			count *= PyLong_AsSsize_t(PyTuple_GET_ITEM(shape, k));
+		}
+
+		bool nested = subfields && subfields != Py_None;
+
+		Py_XDECREF(base);
+		Py_XDECREF(shape);
+		Py_XDECREF(subfields);
+
+		if (PyErr_Occurred()) {
+			ok = false;
+			break;
+		}
+
+		bool swapped = byteorder == (PY_LITTLE_ENDIAN ? '>' : '<');
+		const char * code = (nested || swapped) ? 0 : DTypeField_code(kind, size, attribute->shape);
+
+		if (!code) {
+			MGLError_Set("the field %R (%R) has no buffer format for its attribute", field.name, field.dtype);
+			ok = false;
+			break;
+		}
+
+		if (field.offset > cursor) {
+			length += sprintf(format + length, "%dx ", (int)(field.offset - cursor));
+		}
+
+		length += sprintf(format + length, "%d%s ", (int)count, code);
+		cursor = field.offset + field_size;
+
+		PyList_Append(matched, field.name);
+	}
+
+	if (ok && !PyList_GET_SIZE(matched)) {
+		MGLError_Set("no field of the dtype matches an attribute of the program");
+		ok = false;
+	}
+
+	if (ok && cursor > itemsize) {
+		MGLError_Set("the fields are larger than the itemsize = %zd", itemsize);
+		ok = false;
+	}
+
+	PyObject * result = 0;
+
+	if (ok) {
+		if (cursor < itemsize) {
+			length += sprintf(format + length, "%dx ", (int)(itemsize - cursor));
+		}
+
+		format[length - 1] = 0;
+
+		PyObject * matched_tuple = PyList_AsTuple(matched);
+		result = Py_BuildValue("(sN)", format, matched_tuple);
+	}
+
+	Py_DECREF(matched);
+	Py_DECREF(items);
+	delete[] format;
+	delete[] sorted;
+	return result;
+}
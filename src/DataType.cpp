@@ -1,5 +1,12 @@
 #include "Types.hpp"
 
+#include <cstring>
+
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT1_EXT 0x83F1
+#define GL_COMPRESSED_RGBA_S3TC_DXT3_EXT 0x83F2
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT 0x83F3
+
 static int float_base_format[5] = {0, GL_RED, GL_RG, GL_RGB, GL_RGBA};
 static int int_base_format[5] = {0, GL_RED_INTEGER, GL_RG_INTEGER, GL_RGB_INTEGER, GL_RGBA_INTEGER};
 
@@ -13,6 +20,27 @@ static int i1_internal_format[5] = {0, GL_R8I, GL_RG8I, GL_RGB8I, GL_RGBA8I};
 static int i2_internal_format[5] = {0, GL_R16I, GL_RG16I, GL_RGB16I, GL_RGBA16I};
 static int i4_internal_format[5] = {0, GL_R32I, GL_RG32I, GL_RGB32I, GL_RGBA32I};
 
+// BC1-BC3 are S3TC, BC4 and BC5 are RGTC, BC6 and BC7 are BPTC.
+static int bc1_internal_format[5] = {0, 0, 0, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, GL_COMPRESSED_RGBA_S3TC_DXT1_EXT};
+static int bc2_internal_format[5] = {0, 0, 0, 0, GL_COMPRESSED_RGBA_S3TC_DXT3_EXT};
+static int bc3_internal_format[5] = {0, 0, 0, 0, GL_COMPRESSED_RGBA_S3TC_DXT5_EXT};
+static int bc4_internal_format[5] = {0, GL_COMPRESSED_RED_RGTC1, 0, 0, 0};
+static int bc5_internal_format[5] = {0, 0, GL_COMPRESSED_RG_RGTC2, 0, 0};
+static int bc6_internal_format[5] = {0, 0, 0, GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, 0};
+static int bc7_internal_format[5] = {0, 0, 0, 0, GL_COMPRESSED_RGBA_BPTC_UNORM};
+static int etc2_internal_format[5] = {0, 0, 0, GL_COMPRESSED_RGB8_ETC2, GL_COMPRESSED_RGBA8_ETC2_EAC};
+static int eac_internal_format[5] = {0, GL_COMPRESSED_R11_EAC, GL_COMPRESSED_RG11_EAC, 0, 0};
+
+static int bc1_block_size[5] = {0, 0, 0, 8, 8};
+static int bc2_block_size[5] = {0, 0, 0, 0, 16};
+static int bc3_block_size[5] = {0, 0, 0, 0, 16};
+static int bc4_block_size[5] = {0, 8, 0, 0, 0};
+static int bc5_block_size[5] = {0, 0, 16, 0, 0};
+static int bc6_block_size[5] = {0, 0, 0, 16, 0};
+static int bc7_block_size[5] = {0, 0, 0, 0, 16};
+static int etc2_block_size[5] = {0, 0, 0, 8, 16};
+static int eac_block_size[5] = {0, 8, 16, 0, 0};
+
 static MGLDataType f1 = {float_base_format, f1_internal_format, GL_UNSIGNED_BYTE, 1};
 static MGLDataType f2 = {float_base_format, f2_internal_format, GL_HALF_FLOAT, 2};
 static MGLDataType f4 = {float_base_format, f4_internal_format, GL_FLOAT, 4};
@@ -23,6 +51,16 @@ static MGLDataType i1 = {int_base_format, i1_internal_format, GL_BYTE, 1};
 static MGLDataType i2 = {int_base_format, i2_internal_format, GL_SHORT, 2};
 static MGLDataType i4 = {int_base_format, i4_internal_format, GL_INT, 4};
 
+static MGLDataType bc1 = {float_base_format, bc1_internal_format, GL_UNSIGNED_BYTE, 1, bc1_block_size};
+static MGLDataType bc2 = {float_base_format, bc2_internal_format, GL_UNSIGNED_BYTE, 1, bc2_block_size};
+static MGLDataType bc3 = {float_base_format, bc3_internal_format, GL_UNSIGNED_BYTE, 1, bc3_block_size};
+static MGLDataType bc4 = {float_base_format, bc4_internal_format, GL_UNSIGNED_BYTE, 1, bc4_block_size};
+static MGLDataType bc5 = {float_base_format, bc5_internal_format, GL_UNSIGNED_BYTE, 1, bc5_block_size};
+static MGLDataType bc6 = {float_base_format, bc6_internal_format, GL_UNSIGNED_BYTE, 1, bc6_block_size};
+static MGLDataType bc7 = {float_base_format, bc7_internal_format, GL_UNSIGNED_BYTE, 1, bc7_block_size};
+static MGLDataType etc2 = {float_base_format, etc2_internal_format, GL_UNSIGNED_BYTE, 1, etc2_block_size};
+static MGLDataType eac = {float_base_format, eac_internal_format, GL_UNSIGNED_BYTE, 1, eac_block_size};
+
 MGLDataType * from_dtype(const char * dtype) {
 	if (!dtype[0] || (dtype[1] && dtype[2])) {
 		return 0;
@@ -60,3 +98,28 @@ MGLDataType * from_dtype(const char * dtype) {
 			return 0;
 	}
 }
+
+MGLDataType * from_compressed_dtype(const char * dtype) {
+	static struct {
+		const char * name;
+		MGLDataType * data_type;
+	} compressed[] = {
+		{"bc1", &bc1},
+		{"bc2", &bc2},
+		{"bc3", &bc3},
+		{"bc4", &bc4},
+		{"bc5", &bc5},
+		{"bc6", &bc6},
+		{"bc7", &bc7},
+		{"etc2", &etc2},
+		{"eac", &eac},
+	};
+
+	for (int i = 0; i < (int)(sizeof(compressed) / sizeof(compressed[0])); ++i) {
+		if (!strcmp(dtype, compressed[i].name)) {
+			return compressed[i].data_type;
+		}
+	}
+
+	return 0;
+}
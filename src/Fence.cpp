@@ -0,0 +1,164 @@
+#include "Types.hpp"
+
+PyObject * MGLContext_fence(MGLContext * self, PyObject * args) {
+	int args_ok = PyArg_ParseTuple(
+		args,
+		""
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	if (!gl.FenceSync) {
+		MGLError_Set("fences require OpenGL 3.2 or ARB_sync");
+		return 0;
+	}
+
+	MGLFence * fence = (MGLFence *)MGLFence_Type.tp_alloc(&MGLFence_Type, 0);
+
+	fence->sync = gl.FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	if (!fence->sync) {
+		MGLError_Set("cannot create fence");
+		Py_DECREF(fence);
+		return 0;
+	}
+
+	Py_INCREF(self);
+	fence->context = self;
+
+	Py_INCREF(fence);
+	return (PyObject *)fence;
+}
+
+PyObject * MGLFence_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLFence * self = (MGLFence *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLFence_tp_dealloc(MGLFence * self) {
+	MGLFence_Type.tp_free((PyObject *)self);
+}
+
+PyObject * MGLFence_wait(MGLFence * self, PyObject * args) {
+	long long timeout;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"L",
+		&timeout
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	// The first call flushes the command queue, otherwise the fence may never be signaled.
+	GLenum status = gl.ClientWaitSync(self->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+	if (status == GL_TIMEOUT_EXPIRED && timeout) {
+		Py_BEGIN_ALLOW_THREADS
+		if (timeout < 0) {
+			do {
+				status = gl.ClientWaitSync(self->sync, 0, 1000000000);
+			} while (status == GL_TIMEOUT_EXPIRED);
+		} else {
+			status = gl.ClientWaitSync(self->sync, 0, (GLuint64)timeout);
+		}
+		Py_END_ALLOW_THREADS
+	}
+
+	if (status == GL_WAIT_FAILED) {
+		MGLError_Set("cannot wait for the fence");
+		return 0;
+	}
+
+	return PyBool_FromLong(status != GL_TIMEOUT_EXPIRED);
+}
+
+PyObject * MGLFence_release(MGLFence * self) {
+	MGLFence_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLFence_tp_methods[] = {
+	{"wait", (PyCFunction)MGLFence_wait, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLFence_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyObject * MGLFence_get_signaled(MGLFence * self) {
+	const GLMethods & gl = self->context->gl;
+
+	GLenum status = gl.ClientWaitSync(self->sync, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+	return PyBool_FromLong(status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED);
+}
+
+PyGetSetDef MGLFence_tp_getseters[] = {
+	{(char *)"signaled", (getter)MGLFence_get_signaled, 0, 0, 0},
+	{0},
+};
+
+PyTypeObject MGLFence_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.Fence",                                            // tp_name
+	sizeof(MGLFence),                                       // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLFence_tp_dealloc,                        // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLFence_tp_methods,                                    // tp_methods
+	0,                                                      // tp_members
+	MGLFence_tp_getseters,                                  // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLFence_tp_new,                                        // tp_new
+};
+
+void MGLFence_Invalidate(MGLFence * fence) {
+	if (Py_TYPE(fence) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = fence->context->gl;
+	gl.DeleteSync(fence->sync);
+
+	Py_DECREF(fence->context);
+	Py_TYPE(fence) = &MGLInvalidObject_Type;
+	Py_DECREF(fence);
+}
@@ -531,7 +531,7 @@ PyObject * MGLFramebuffer_read(MGLFramebuffer * self, PyObject * args) {
 		read_depth = true;
 	}
 
-	int expected_size = width * components * data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
@@ -646,7 +646,7 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		read_depth = true;
 	}
 
-	int expected_size = width * components * data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
@@ -698,7 +698,7 @@ PyObject * MGLFramebuffer_read_into(MGLFramebuffer * self, PyObject * args) {
 		PyBuffer_Release(&buffer_view);
 	}
 
-	return PyLong_FromLong(expected_size);
+	return PyLong_FromSsize_t(expected_size);
 }
 
 PyMethodDef MGLFramebuffer_tp_methods[] = {
@@ -23,6 +23,29 @@ GLVersion version[] = {
 
 int versions = sizeof(version) / sizeof(GLVersion);
 
+// Only the Linux build has an egl backend, the other platforms must not ignore the request.
+bool CheckDefaultBackend(PyObject * settings) {
+	PyObject * backend = (settings != Py_None) ? PyDict_GetItemString(settings, "backend") : 0;
+
+	if (!backend || backend == Py_None) {
+		return true;
+	}
+
+	const char * backend_name = PyUnicode_AsUTF8(backend);
+
+	if (!backend_name) {
+		MGLError_Set("invalid backend");
+		return false;
+	}
+
+	if (!strcmp(backend_name, "egl")) {
+		MGLError_Set("the egl backend is only available on Linux");
+		return false;
+	}
+
+	return true;
+}
+
 #if defined(_WIN32) || defined(_WIN64)
 
 #include <Windows.h>
@@ -217,6 +240,10 @@ GLContext CreateGLContext(PyObject * settings) {
 	GLContext context = {};
 	context.standalone = true;
 
+	if (!CheckDefaultBackend(settings)) {
+		return context;
+	}
+
 	int width = 1;
 	int height = 1;
 	PyObject * size_hint = (settings != Py_None) ? PyDict_GetItemString(settings, "size") : 0;
@@ -410,6 +437,10 @@ GLContext CreateGLContext(PyObject * settings) {
 	GLContext context = {};
 	context.standalone = true;
 
+	if (!CheckDefaultBackend(settings)) {
+		return context;
+	}
+
 	int width = 1;
 	int height = 1;
 	PyObject * size_hint = (settings != Py_None) ? PyDict_GetItemString(settings, "size") : 0;
@@ -604,7 +635,252 @@ int SilentXErrorHandler(Display * d, XErrorEvent * e) {
     return 0;
 }
 
+#include <dlfcn.h>
+
+#define EGL_DONT_CARE -1
+#define EGL_NONE 0x3038
+#define EGL_SURFACE_TYPE 0x3033
+#define EGL_PBUFFER_BIT 0x0001
+#define EGL_WIDTH 0x3057
+#define EGL_HEIGHT 0x3056
+#define EGL_RENDERABLE_TYPE 0x3040
+#define EGL_OPENGL_API 0x30A2
+#define EGL_OPENGL_BIT 0x0008
+#define EGL_CONTEXT_MAJOR_VERSION 0x3098
+#define EGL_CONTEXT_MINOR_VERSION 0x30FB
+#define EGL_CONTEXT_OPENGL_PROFILE_MASK 0x30FD
+#define EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT 0x0001
+#define EGL_PLATFORM_DEVICE_EXT 0x313F
+#define EGL_PLATFORM_SURFACELESS_MESA 0x31DD
+
+typedef void * (* PROC_eglGetProcAddress)(const char * procname);
+typedef void * (* PROC_eglGetPlatformDisplayEXT)(int platform, void * native_display, const int * attrib_list);
+typedef unsigned (* PROC_eglQueryDevicesEXT)(int max_devices, void ** devices, int * num_devices);
+typedef unsigned (* PROC_eglInitialize)(void * dpy, int * major, int * minor);
+typedef void * (* PROC_eglGetCurrentContext)();
+typedef unsigned (* PROC_eglBindAPI)(unsigned api);
+typedef unsigned (* PROC_eglChooseConfig)(void * dpy, const int * attrib_list, void ** configs, int config_size, int * num_config);
+typedef void * (* PROC_eglCreateContext)(void * dpy, void * config, void * share_context, const int * attrib_list);
+typedef unsigned (* PROC_eglDestroyContext)(void * dpy, void * ctx);
+typedef unsigned (* PROC_eglMakeCurrent)(void * dpy, void * draw, void * read, void * ctx);
+typedef void * (* PROC_eglCreatePbufferSurface)(void * dpy, void * config, const int * attrib_list);
+typedef unsigned (* PROC_eglDestroySurface)(void * dpy, void * surface);
+
+struct EGLMethods {
+	PROC_eglGetPlatformDisplayEXT GetPlatformDisplayEXT;
+	PROC_eglQueryDevicesEXT QueryDevicesEXT;
+	PROC_eglInitialize Initialize;
+	PROC_eglGetCurrentContext GetCurrentContext;
+	PROC_eglBindAPI BindAPI;
+	PROC_eglChooseConfig ChooseConfig;
+	PROC_eglCreateContext CreateContext;
+	PROC_eglDestroyContext DestroyContext;
+	PROC_eglMakeCurrent MakeCurrent;
+	PROC_eglCreatePbufferSurface CreatePbufferSurface;
+	PROC_eglDestroySurface DestroySurface;
+};
+
+// libEGL is loaded at runtime so that the GLX only setups do not depend on it.
+
+const EGLMethods * LoadEGLMethods() {
+	static EGLMethods egl = {};
+	static bool loaded = false;
+
+	if (loaded) {
+		return egl.MakeCurrent ? &egl : 0;
+	}
+
+	loaded = true;
+
+	void * libegl = dlopen("libEGL.so.1", RTLD_LAZY);
+
+	if (!libegl) {
+		return 0;
+	}
+
+	PROC_eglGetProcAddress eglGetProcAddress = (PROC_eglGetProcAddress)dlsym(libegl, "eglGetProcAddress");
+
+	if (!eglGetProcAddress) {
+		return 0;
+	}
+
+	egl.GetPlatformDisplayEXT = (PROC_eglGetPlatformDisplayEXT)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	egl.QueryDevicesEXT = (PROC_eglQueryDevicesEXT)eglGetProcAddress("eglQueryDevicesEXT");
+	egl.Initialize = (PROC_eglInitialize)dlsym(libegl, "eglInitialize");
+	egl.GetCurrentContext = (PROC_eglGetCurrentContext)dlsym(libegl, "eglGetCurrentContext");
+	egl.BindAPI = (PROC_eglBindAPI)dlsym(libegl, "eglBindAPI");
+	egl.ChooseConfig = (PROC_eglChooseConfig)dlsym(libegl, "eglChooseConfig");
+	egl.CreateContext = (PROC_eglCreateContext)dlsym(libegl, "eglCreateContext");
+	egl.DestroyContext = (PROC_eglDestroyContext)dlsym(libegl, "eglDestroyContext");
+	egl.MakeCurrent = (PROC_eglMakeCurrent)dlsym(libegl, "eglMakeCurrent");
+	egl.CreatePbufferSurface = (PROC_eglCreatePbufferSurface)dlsym(libegl, "eglCreatePbufferSurface");
+	egl.DestroySurface = (PROC_eglDestroySurface)dlsym(libegl, "eglDestroySurface");
+
+	if (!egl.GetPlatformDisplayEXT || !egl.Initialize || !egl.GetCurrentContext || !egl.BindAPI || !egl.ChooseConfig || !egl.CreateContext || !egl.DestroyContext || !egl.MakeCurrent || !egl.CreatePbufferSurface || !egl.DestroySurface) {
+		egl.MakeCurrent = 0;
+		return 0;
+	}
+
+	return &egl;
+}
+
+void * OpenEGLDisplay(const EGLMethods & egl, int device_index) {
+	// Mesa (llvmpipe, radeonsi, iris) supports the surfaceless platform without any device enumeration.
+	if (device_index < 0) {
+		void * dpy = egl.GetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, 0, 0);
+
+		if (dpy && egl.Initialize(dpy, 0, 0)) {
+			return dpy;
+		}
+
+		device_index = 0;
+	}
+
+	// Other vendors only expose their GPUs through EGL_EXT_platform_device.
+	if (!egl.QueryDevicesEXT) {
+		return 0;
+	}
+
+	void * devices[16] = {};
+	int num_devices = 0;
+
+	if (!egl.QueryDevicesEXT(16, devices, &num_devices) || device_index >= num_devices) {
+		return 0;
+	}
+
+	void * dpy = egl.GetPlatformDisplayEXT(EGL_PLATFORM_DEVICE_EXT, devices[device_index], 0);
+
+	if (dpy && egl.Initialize(dpy, 0, 0)) {
+		return dpy;
+	}
+
+	return 0;
+}
+
+GLContext CreateEGLContext(PyObject * settings) {
+	GLContext context = {};
+	context.standalone = true;
+	context.egl = true;
+
+	int device_index = -1;
+	PyObject * device_hint = (settings != Py_None) ? PyDict_GetItemString(settings, "device_index") : 0;
+	if (device_hint && PyLong_Check(device_hint)) {
+		device_index = PyLong_AsLong(device_hint);
+	}
+
+	const EGLMethods * egl = LoadEGLMethods();
+
+	if (!egl) {
+		MGLError_Set("cannot load libEGL.so.1");
+		return context;
+	}
+
+	void * dpy = OpenEGLDisplay(*egl, device_index);
+
+	if (!dpy) {
+		MGLError_Set("cannot open a surfaceless or device EGL display");
+		return context;
+	}
+
+	if (!egl->BindAPI(EGL_OPENGL_API)) {
+		MGLError_Set("cannot bind the OpenGL API");
+		return context;
+	}
+
+	static int pbuffer_config_attribs[] = {
+		EGL_SURFACE_TYPE, EGL_PBUFFER_BIT,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_NONE,
+	};
+
+	static int config_attribs[] = {
+		EGL_SURFACE_TYPE, EGL_DONT_CARE,
+		EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+		EGL_NONE,
+	};
+
+	void * config = 0;
+	int num_configs = 0;
+
+	// A pbuffer config is preferred, the 1x1 pbuffer serves as the default framebuffer.
+	bool pbuffer = egl->ChooseConfig(dpy, pbuffer_config_attribs, &config, 1, &num_configs) && num_configs;
+
+	if (!pbuffer && (!egl->ChooseConfig(dpy, config_attribs, &config, 1, &num_configs) || !num_configs)) {
+		MGLError_Set("cannot choose an EGL config");
+		return context;
+	}
+
+	void * ctx = 0;
+
+	for (int i = 0; i < versions; ++i) {
+		int attribs[] = {
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_CONTEXT_MAJOR_VERSION, version[i].major,
+			EGL_CONTEXT_MINOR_VERSION, version[i].minor,
+			EGL_NONE,
+		};
+
+		ctx = egl->CreateContext(dpy, config, 0, version[i].major ? attribs : 0);
+
+		if (ctx) {
+			break;
+		}
+	}
+
+	if (!ctx) {
+		MGLError_Set("cannot create OpenGL context");
+		return context;
+	}
+
+	static int pbuffer_attribs[] = {
+		EGL_WIDTH, 1,
+		EGL_HEIGHT, 1,
+		EGL_NONE,
+	};
+
+	// Like the hidden 1x1 window of the other backends the pbuffer makes draw calls complete,
+	// without it there is no default framebuffer and rendering is only possible into framebuffer objects.
+	void * surface = pbuffer ? egl->CreatePbufferSurface(dpy, config, pbuffer_attribs) : 0;
+
+	if (!egl->MakeCurrent(dpy, surface, surface, ctx)) {
+		if (surface) {
+			egl->DestroySurface(dpy, surface);
+		}
+
+		egl->DestroyContext(dpy, ctx);
+
+		MGLError_Set("cannot select OpenGL context");
+		return context;
+	}
+
+	context.display = dpy;
+	context.window = surface;
+	context.context = ctx;
+
+	return context;
+}
+
 GLContext CreateGLContext(PyObject * settings) {
+	PyObject * backend = (settings != Py_None) ? PyDict_GetItemString(settings, "backend") : 0;
+
+	if (backend && backend != Py_None) {
+		const char * backend_name = PyUnicode_AsUTF8(backend);
+
+		if (!backend_name) {
+			MGLError_Set("invalid backend");
+			return {};
+		}
+
+		if (!strcmp(backend_name, "egl")) {
+			return CreateEGLContext(settings);
+		}
+
+		if (strcmp(backend_name, "glx")) {
+			MGLError_Set("invalid backend: %s", backend_name);
+			return {};
+		}
+	}
+
 	GLContext context = {};
 	context.standalone = true;
 
@@ -735,6 +1011,27 @@ void DestroyGLContext(const GLContext & context) {
 		return;
 	}
 
+	if (context.egl) {
+		const EGLMethods * egl = LoadEGLMethods();
+
+		// The display is shared by every EGL context of the process, it is never terminated.
+		if (egl && context.display) {
+			if (egl->GetCurrentContext() == context.context) {
+				egl->MakeCurrent(context.display, 0, 0, 0);
+			}
+
+			if (context.context) {
+				egl->DestroyContext(context.display, context.context);
+			}
+
+			if (context.window) {
+				egl->DestroySurface(context.display, context.window);
+			}
+		}
+
+		return;
+	}
+
 	if (context.display) {
 		glXMakeCurrent((Display *)context.display, 0, 0);
 
@@ -0,0 +1,265 @@
+#pragma once
+
+#include "Python.hpp"
+
+#include <cstring>
+
+// Header only, both extensions list src in their include_dirs.
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MGL_GATHER_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(MGL_GATHER_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MGL_GATHER_AVX2
+#include <immintrin.h>
+#endif
+
+typedef void (* GatherProc)(char * dst, const char * src, Py_ssize_t count, Py_ssize_t size, Py_ssize_t stride);
+
+inline void GatherScalar(char * dst, const char * src, Py_ssize_t count, Py_ssize_t size, Py_ssize_t stride) {
+	// The constant sized copies compile to plain moves.
+	switch (size) {
+		case 4:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst, src, 4);
+				dst += 4;
+				src += stride;
+			}
+			break;
+
+		case 8:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst, src, 8);
+				dst += 8;
+				src += stride;
+			}
+			break;
+
+		case 12:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst, src, 12);
+				dst += 12;
+				src += stride;
+			}
+			break;
+
+		default:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst, src, size);
+				dst += size;
+				src += stride;
+			}
+			break;
+	}
+}
+
+#ifdef MGL_GATHER_SSE2
+
+inline void GatherSSE2(char * dst, const char * src, Py_ssize_t count, Py_ssize_t size, Py_ssize_t stride) {
+	Py_ssize_t i = 0;
+
+	if (size == 4) {
+		for (; i + 4 <= count; i += 4) {
+			int item[4];
+			memcpy(&item[0], src, 4);
+			memcpy(&item[1], src + stride, 4);
+			memcpy(&item[2], src + stride * 2, 4);
+			memcpy(&item[3], src + stride * 3, 4);
+			_mm_storeu_si128((__m128i *)dst, _mm_setr_epi32(item[0], item[1], item[2], item[3]));
+			dst += 16;
+			src += stride * 4;
+		}
+	} else if (size == 8) {
+		for (; i + 2 <= count; i += 2) {
+			__m128i lo = _mm_loadl_epi64((const __m128i *)src);
+			__m128i hi = _mm_loadl_epi64((const __m128i *)(src + stride));
+			_mm_storeu_si128((__m128i *)dst, _mm_unpacklo_epi64(lo, hi));
+			dst += 16;
+			src += stride * 2;
+		}
+	} else if (size == 16) {
+		for (; i < count; ++i) {
+			_mm_storeu_si128((__m128i *)dst, _mm_loadu_si128((const __m128i *)src));
+			dst += 16;
+			src += stride;
+		}
+	}
+
+	GatherScalar(dst, src, count - i, size, stride);
+}
+
+#endif
+
+#ifdef MGL_GATHER_AVX2
+
+__attribute__((target("avx2")))
+inline void GatherAVX2(char * dst, const char * src, Py_ssize_t count, Py_ssize_t size, Py_ssize_t stride) {
+	Py_ssize_t i = 0;
+
+	// The gather instructions take 32-bit byte offsets relative to the first item.
+	if (stride > -0x10000000 && stride < 0x10000000) {
+		if (size == 4) {
+			__m256i index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32((int)stride));
+			for (; i + 8 <= count; i += 8) {
+				_mm256_storeu_si256((__m256i *)dst, _mm256_i32gather_epi32((const int *)src, index, 1));
+				dst += 32;
+				src += stride * 8;
+			}
+		} else if (size == 8) {
+			__m128i index = _mm_mullo_epi32(_mm_setr_epi32(0, 1, 2, 3), _mm_set1_epi32((int)stride));
+			for (; i + 4 <= count; i += 4) {
+				_mm256_storeu_si256((__m256i *)dst, _mm256_i32gather_epi64((const long long *)src, index, 1));
+				dst += 32;
+				src += stride * 4;
+			}
+		}
+	}
+
+	GatherSSE2(dst, src, count - i, size, stride);
+}
+
+#endif
+
+inline GatherProc SelectGatherProc() {
+#ifdef MGL_GATHER_AVX2
+	if (__builtin_cpu_supports("avx2")) {
+		return GatherAVX2;
+	}
+#endif
+
+#ifdef MGL_GATHER_SSE2
+	return GatherSSE2;
+#else
+	return GatherScalar;
+#endif
+}
+
+// Copies the items of a strided view into dst, which must have room for view->len bytes.
+// Only one and two dimensional views are handled, false is returned for any other view.
+inline bool StridedGather(char * dst, const Py_buffer * view) {
+	static GatherProc gather = SelectGatherProc();
+
+	const char * src = (const char *)view->buf;
+
+	if (view->ndim == 1) {
+		gather(dst, src, view->shape[0], view->itemsize, view->strides[0]);
+		return true;
+	}
+
+	if (view->ndim == 2) {
+		// Rows with contiguous items are gathered as single wide items.
+		if (view->strides[1] == view->itemsize) {
+			gather(dst, src, view->shape[0], view->shape[1] * view->itemsize, view->strides[0]);
+			return true;
+		}
+
+		Py_ssize_t row_size = view->shape[1] * view->itemsize;
+
+		for (Py_ssize_t i = 0; i < view->shape[0]; ++i) {
+			gather(dst + i * row_size, src + i * view->strides[0], view->shape[1], view->itemsize, view->strides[1]);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+// Merges the dimensions of a view that step through memory evenly.
+// The trailing contiguous dimensions become a single item of run bytes,
+// the other dimensions are returned from the outermost with their counts and byte strides.
+inline int CollapseView(const Py_buffer * view, Py_ssize_t * shape, Py_ssize_t * strides, Py_ssize_t * run) {
+	int last = view->ndim - 1;
+	*run = view->itemsize;
+
+	while (last >= 0 && (view->shape[last] == 1 || view->strides[last] == *run)) {
+		*run *= view->shape[last];
+		--last;
+	}
+
+	int ndim = 0;
+
+	for (int i = 0; i <= last; ++i) {
+		if (view->shape[i] == 1) {
+			continue;
+		}
+
+		if (ndim && strides[ndim - 1] == view->shape[i] * view->strides[i]) {
+			shape[ndim - 1] *= view->shape[i];
+			strides[ndim - 1] = view->strides[i];
+			continue;
+		}
+
+		shape[ndim] = view->shape[i];
+		strides[ndim] = view->strides[i];
+		++ndim;
+	}
+
+	return ndim;
+}
+
+// Finds the row and image strides of a view holding depth images of height rows of row_size bytes.
+// False is returned if the rows are not contiguous or the strides do not repeat evenly.
+inline bool PixelLayout(const Py_buffer * view, Py_ssize_t row_size, int height, int depth, Py_ssize_t * row_stride, Py_ssize_t * image_stride) {
+	Py_ssize_t shape[PyBUF_MAX_NDIM + 1];
+	Py_ssize_t strides[PyBUF_MAX_NDIM + 1];
+	Py_ssize_t run;
+
+	if (row_size < 1 || view->len != row_size * height * depth) {
+		return false;
+	}
+
+	int ndim = CollapseView(view, shape, strides, &run);
+
+	// Full rows following each other in the contiguous run are a dimension of their own.
+	if (run != row_size) {
+		if (run % row_size) {
+			return false;
+		}
+
+		shape[ndim] = run / row_size;
+		strides[ndim] = row_size;
+		++ndim;
+	}
+
+	if (ndim == 0) {
+		*row_stride = row_size;
+		*image_stride = row_size;
+	} else if (ndim == 1) {
+		*row_stride = strides[0];
+		*image_stride = strides[0] * height;
+	} else if (ndim == 2 && shape[1] == height) {
+		*row_stride = strides[1];
+		*image_stride = strides[0];
+	} else {
+		return false;
+	}
+
+	return *row_stride >= row_size && *image_stride >= *row_stride * height;
+}
+
+// Copies the items of any strided view into dst, the contiguous dimensions are merged first.
+inline void PixelGather(char * dst, const Py_buffer * view) {
+	Py_ssize_t shape[PyBUF_MAX_NDIM];
+	Py_ssize_t strides[PyBUF_MAX_NDIM];
+	Py_ssize_t run;
+
+	int ndim = CollapseView(view, shape, strides, &run);
+
+	if (ndim == 0) {
+		memcpy(dst, view->buf, view->len);
+		return;
+	}
+
+	Py_buffer collapsed = *view;
+	collapsed.itemsize = run;
+	collapsed.ndim = ndim;
+	collapsed.shape = shape;
+	collapsed.strides = strides;
+
+	if (!StridedGather(dst, &collapsed)) {
+		PyBuffer_ToContiguous(dst, (Py_buffer *)view, view->len, 'C');
+	}
+}
@@ -0,0 +1,179 @@
+#include "Interleave.hpp"
+
+#include "BufferFormat.hpp"
+#include "Error.hpp"
+
+#include <cstring>
+
+bool InterleaveLayout_Init(InterleaveLayout * layout, const char * format, PyObject * arrays) {
+	layout->sources = 0;
+	layout->num_sources = 0;
+	layout->stride = 0;
+	layout->padding = false;
+	layout->vertices = 0;
+
+	FormatIterator it = FormatIterator(format);
+	FormatInfo format_info = it.info();
+
+	if (!format_info.valid || !format_info.nodes) {
+		MGLError_Set("invalid format");
+		return false;
+	}
+
+	int num_arrays = (int)PyTuple_GET_SIZE(arrays);
+
+	if (num_arrays != format_info.nodes) {
+		MGLError_Set("format and arrays size mismatch %d != %d", format_info.nodes, num_arrays);
+		return false;
+	}
+
+	layout->sources = new InterleaveSource[num_arrays];
+	layout->stride = format_info.size;
+
+	int offset = 0;
+
+	while (FormatNode * node = it.next()) {
+		if (!node->type) {
+			layout->padding = true;
+			offset += node->size;
+			continue;
+		}
+
+		int i = layout->num_sources;
+		InterleaveSource & source = layout->sources[i];
+		PyObject * array = PyTuple_GET_ITEM(arrays, i);
+
+		if (PyObject_GetBuffer(array, &source.view, PyBUF_STRIDED_RO) < 0) {
+			PyErr_Clear();
+			MGLError_Set("arrays[%d] (%s) does not support buffer interface", i, Py_TYPE(array)->tp_name);
+			InterleaveLayout_Release(layout);
+			return false;
+		}
+
+		layout->num_sources += 1;
+		source.offset = offset;
+		source.size = node->size;
+		offset += node->size;
+
+		if (source.view.len % node->size) {
+			MGLError_Set("arrays[%d] (%zd bytes) is not a multiple of the attribute size %d", i, source.view.len, node->size);
+			InterleaveLayout_Release(layout);
+			return false;
+		}
+
+		Py_ssize_t vertices = source.view.len / node->size;
+
+		if (i == 0) {
+			layout->vertices = vertices;
+		} else if (vertices != layout->vertices) {
+			MGLError_Set("arrays[%d] has %zd vertices instead of %zd", i, vertices, layout->vertices);
+			InterleaveLayout_Release(layout);
+			return false;
+		}
+
+		if (PyBuffer_IsContiguous(&source.view, 'C')) {
+			source.stride = node->size;
+			continue;
+		}
+
+		// Strided arrays are supported as long as the bytes of a single vertex are contiguous.
+		Py_ssize_t row_size = source.view.itemsize;
+		for (int d = source.view.ndim - 1; d > 0; --d) {
+			if (source.view.strides[d] != row_size) {
+				row_size = -1;
+				break;
+			}
+			row_size *= source.view.shape[d];
+		}
+
+		if (row_size != node->size || source.view.shape[0] != vertices) {
+			MGLError_Set("arrays[%d] must have contiguous vertices", i);
+			InterleaveLayout_Release(layout);
+			return false;
+		}
+
+		source.stride = source.view.strides[0];
+	}
+
+	return true;
+}
+
+inline void InterleaveCopy(char * dst, Py_ssize_t dst_stride, const char * src, Py_ssize_t src_stride, Py_ssize_t count, int size) {
+	// The constant sized copies compile to plain moves.
+	switch (size) {
+		case 4:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst + i * dst_stride, src + i * src_stride, 4);
+			}
+			break;
+
+		case 8:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst + i * dst_stride, src + i * src_stride, 8);
+			}
+			break;
+
+		case 12:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst + i * dst_stride, src + i * src_stride, 12);
+			}
+			break;
+
+		case 16:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst + i * dst_stride, src + i * src_stride, 16);
+			}
+			break;
+
+		default:
+			for (Py_ssize_t i = 0; i < count; ++i) {
+				memcpy(dst + i * dst_stride, src + i * src_stride, size);
+			}
+			break;
+	}
+}
+
+void InterleaveLayout_Write(const InterleaveLayout * layout, char * dst) {
+	// The padding must stay untouched, the attributes are written in place.
+	if (layout->padding) {
+		for (int i = 0; i < layout->num_sources; ++i) {
+			const InterleaveSource & source = layout->sources[i];
+			InterleaveCopy(dst + source.offset, layout->stride, (const char *)source.view.buf, source.stride, layout->vertices, source.size);
+		}
+		return;
+	}
+
+	// Blocks of vertices are interleaved in a cache resident buffer and copied out sequentially,
+	// mapped memory is often write combined and slow to write in a scattered order.
+	char block[16384];
+	Py_ssize_t block_vertices = sizeof(block) / layout->stride;
+
+	if (!block_vertices) {
+		for (int i = 0; i < layout->num_sources; ++i) {
+			const InterleaveSource & source = layout->sources[i];
+			InterleaveCopy(dst + source.offset, layout->stride, (const char *)source.view.buf, source.stride, layout->vertices, source.size);
+		}
+		return;
+	}
+
+	for (Py_ssize_t first = 0; first < layout->vertices; first += block_vertices) {
+		Py_ssize_t count = layout->vertices - first < block_vertices ? layout->vertices - first : block_vertices;
+
+		for (int i = 0; i < layout->num_sources; ++i) {
+			const InterleaveSource & source = layout->sources[i];
+			InterleaveCopy(block + source.offset, layout->stride, (const char *)source.view.buf + first * source.stride, source.stride, count, source.size);
+		}
+
+		memcpy(dst + first * layout->stride, block, count * layout->stride);
+	}
+}
+
+void InterleaveLayout_Release(InterleaveLayout * layout) {
+	for (int i = 0; i < layout->num_sources; ++i) {
+		PyBuffer_Release(&layout->sources[i].view);
+	}
+
+	delete[] layout->sources;
+	layout->sources = 0;
+	layout->num_sources = 0;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Python.hpp"
+
+struct InterleaveSource {
+	Py_buffer view;
+	Py_ssize_t stride;
+	int offset;
+	int size;
+};
+
+struct InterleaveLayout {
+	InterleaveSource * sources;
+	int num_sources;
+	int stride;
+	bool padding;
+	Py_ssize_t vertices;
+};
+
+// Matches the arrays to the non padding nodes of the format, sets the error and returns false on mismatch.
+bool InterleaveLayout_Init(InterleaveLayout * layout, const char * format, PyObject * arrays);
+
+// Writes layout->vertices * layout->stride bytes to dst, padding bytes are not written.
+void InterleaveLayout_Write(const InterleaveLayout * layout, char * dst);
+
+void InterleaveLayout_Release(InterleaveLayout * layout);
@@ -2,9 +2,13 @@
 #include "Error.hpp"
 
 #include "BufferFormat.hpp"
+#include "Convert.hpp"
+#include "Interleave.hpp"
 
 #include "GLContext.hpp"
 
+#include <cstring>
+
 PyObject * strsize(PyObject * self, PyObject * args) {
 	const char * str;
 
@@ -100,6 +104,194 @@ PyObject * fmtdebug(PyObject * self, PyObject * args) {
 	return res;
 }
 
+PyObject * pack(PyObject * self, PyObject * args) {
+	const char * format;
+	PyObject * arrays;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"sO!",
+		&format,
+		&PyTuple_Type,
+		&arrays
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	InterleaveLayout layout;
+
+	if (!InterleaveLayout_Init(&layout, format, arrays)) {
+		return 0;
+	}
+
+	PyObject * res = PyBytes_FromStringAndSize(0, layout.vertices * layout.stride);
+
+	if (!res) {
+		InterleaveLayout_Release(&layout);
+		return 0;
+	}
+
+	char * data = PyBytes_AS_STRING(res);
+
+	if (layout.padding) {
+		memset(data, 0, layout.vertices * layout.stride);
+	}
+
+	InterleaveLayout_Write(&layout, data);
+	InterleaveLayout_Release(&layout);
+	return res;
+}
+
+bool GetFloatVertices(Py_buffer * view, PyObject * data, int components) {
+	if (PyObject_GetBuffer(data, view, PyBUF_SIMPLE) < 0) {
+		PyErr_Clear();
+		MGLError_Set("data (%s) must be a contiguous buffer", Py_TYPE(data)->tp_name);
+		return false;
+	}
+
+	if (view->len % (components * 4)) {
+		MGLError_Set("data (%zd bytes) is not a whole number of %d component float vertices", view->len, components);
+		PyBuffer_Release(view);
+		return false;
+	}
+
+	return true;
+}
+
+PyObject * encode_normals(PyObject * self, PyObject * args) {
+	PyObject * data;
+	int components;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OI",
+		&data,
+		&components
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (components != 3 && components != 4) {
+		MGLError_Set("components must be 3 or 4 not %d", components);
+		return 0;
+	}
+
+	Py_buffer view;
+
+	if (!GetFloatVertices(&view, data, components)) {
+		return 0;
+	}
+
+	Py_ssize_t vertices = view.len / (components * 4);
+	PyObject * res = PyBytes_FromStringAndSize(0, vertices * 4);
+
+	if (res) {
+		EncodeNormals((unsigned *)PyBytes_AS_STRING(res), (const float *)view.buf, vertices, components);
+	}
+
+	PyBuffer_Release(&view);
+	return res;
+}
+
+PyObject * quantize(PyObject * self, PyObject * args) {
+	PyObject * data;
+	int components;
+	const char * dtype;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OIs",
+		&data,
+		&components,
+		&dtype
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (components < 1 || components > 4) {
+		MGLError_Set("components must be 1, 2, 3 or 4 not %d", components);
+		return 0;
+	}
+
+	ConvertType dst_type = {};
+
+	if (!strcmp(dtype, "n1")) {
+		dst_type.type = GL_BYTE;
+		dst_type.size = 1;
+		dst_type.normalize = true;
+	} else if (!strcmp(dtype, "n2")) {
+		dst_type.type = GL_SHORT;
+		dst_type.size = 2;
+		dst_type.normalize = true;
+	} else if (!strcmp(dtype, "f2")) {
+		dst_type.type = GL_HALF_FLOAT;
+		dst_type.size = 2;
+	} else {
+		MGLError_Set("invalid dtype");
+		return 0;
+	}
+
+	Py_buffer view;
+
+	if (!GetFloatVertices(&view, data, components)) {
+		return 0;
+	}
+
+	const ConvertType src_type = {GL_FLOAT, 4, false};
+
+	const float * src = (const float *)view.buf;
+	Py_ssize_t count = view.len / 4;
+
+	float offset[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+	float scale[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+	PyObject * bytes = PyBytes_FromStringAndSize(0, count * dst_type.size);
+
+	if (!bytes) {
+		PyBuffer_Release(&view);
+		return 0;
+	}
+
+	char * dst = PyBytes_AS_STRING(bytes);
+
+	if (dst_type.type == GL_HALF_FLOAT) {
+		// Half floats keep the positions as they are.
+		ConvertValues(dst, dst_type, (const char *)src, src_type, count);
+	} else {
+		QuantizeBounds(offset, scale, src, count / components, components);
+
+		// A multiple of twelve keeps every block starting on a whole vertex.
+		float block[4092];
+		for (Py_ssize_t i = 0; i < count; i += 4092) {
+			Py_ssize_t chunk = count - i < 4092 ? count - i : 4092;
+			QuantizeValues(block, src + i, chunk, offset, scale, components);
+			ConvertValues(dst + i * dst_type.size, dst_type, (const char *)block, src_type, chunk);
+		}
+	}
+
+	PyBuffer_Release(&view);
+
+	PyObject * scale_tuple = PyTuple_New(components);
+	PyObject * offset_tuple = PyTuple_New(components);
+
+	for (int c = 0; c < components; ++c) {
+		PyTuple_SET_ITEM(scale_tuple, c, PyFloat_FromDouble(scale[c]));
+		PyTuple_SET_ITEM(offset_tuple, c, PyFloat_FromDouble(offset[c]));
+	}
+
+	PyObject * res = PyTuple_New(3);
+	PyTuple_SET_ITEM(res, 0, bytes);
+	PyTuple_SET_ITEM(res, 1, scale_tuple);
+	PyTuple_SET_ITEM(res, 2, offset_tuple);
+	return res;
+}
+
 PyObject * create_standalone_context(PyObject * self, PyObject * args) {
 	PyObject * settings;
 
@@ -160,11 +352,23 @@ PyObject * create_context(PyObject * self) {
 	return result;
 }
 
+PyObject * data_type(PyObject * self, PyObject * args);
+PyObject * dlpack(PyObject * self, PyObject * args);
+PyObject * dtype_format(PyObject * self, PyObject * args);
+PyObject * content_hash(PyObject * self, PyObject * args);
+
 PyMethodDef MGL_module_methods[] = {
 	{"strsize", (PyCFunction)strsize, METH_VARARGS, 0},
 	{"create_standalone_context", (PyCFunction)create_standalone_context, METH_VARARGS, 0},
 	{"create_context", (PyCFunction)create_context, METH_NOARGS, 0},
 	{"fmtdebug", (PyCFunction)fmtdebug, METH_VARARGS, 0},
+	{"pack", (PyCFunction)pack, METH_VARARGS, 0},
+	{"encode_normals", (PyCFunction)encode_normals, METH_VARARGS, 0},
+	{"quantize", (PyCFunction)quantize, METH_VARARGS, 0},
+	{"data_type", (PyCFunction)data_type, METH_VARARGS, 0},
+	{"dlpack", (PyCFunction)dlpack, METH_VARARGS, 0},
+	{"dtype_format", (PyCFunction)dtype_format, METH_VARARGS, 0},
+	{"content_hash", (PyCFunction)content_hash, METH_VARARGS, 0},
 	{0},
 };
 
@@ -246,6 +450,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "Program", (PyObject *)&MGLProgram_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLFence_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register Fence in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLFence_Type);
+
+		PyModule_AddObject(module, "Fence", (PyObject *)&MGLFence_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLQuery_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Query in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -312,6 +527,17 @@ bool MGL_InitializeModule(PyObject * module) {
 		PyModule_AddObject(module, "TextureCube", (PyObject *)&MGLTextureCube_Type);
 	}
 
+	{
+		if (PyType_Ready(&MGLTextureBuffer_Type) < 0) {
+			PyErr_Format(PyExc_ImportError, "Cannot register TextureBuffer in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
+			return false;
+		}
+
+		Py_INCREF(&MGLTextureBuffer_Type);
+
+		PyModule_AddObject(module, "TextureBuffer", (PyObject *)&MGLTextureBuffer_Type);
+	}
+
 	{
 		if (PyType_Ready(&MGLTexture3D_Type) < 0) {
 			PyErr_Format(PyExc_ImportError, "Cannot register Texture3D in %s (%s:%d)", __FUNCTION__, __FILE__, __LINE__);
@@ -519,6 +519,7 @@ PyObject * MGLContext_program(MGLContext * self, PyObject * args) {
 		mglo->size = size;
 		mglo->program_obj = program->program_obj;
 		mglo->gl = &gl;
+		MGLUniformBlock_Complete(mglo, gl);
 
 		PyObject * item = PyTuple_New(4);
 		PyTuple_SET_ITEM(item, 0, (PyObject *)mglo);
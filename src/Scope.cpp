@@ -74,6 +74,10 @@ PyObject * MGLContext_scope(MGLContext * self, PyObject * args) {
 			MGLTextureCube * texture = (MGLTextureCube *)item;
 			texture_type = GL_TEXTURE_CUBE_MAP;
 			texture_obj = texture->texture_obj;
+		} else if (Py_TYPE(item) == &MGLTextureBuffer_Type) {
+			MGLTextureBuffer * texture = (MGLTextureBuffer *)item;
+			texture_type = GL_TEXTURE_BUFFER;
+			texture_obj = texture->texture_obj;
 		} else {
 			MGLError_Set("invalid texture");
 			return 0;
@@ -1,6 +1,9 @@
 #include "Types.hpp"
 
 #include "InlineMethods.hpp"
+#include "Gather.hpp"
+
+#include <climits>
 
 PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	int width;
@@ -53,22 +56,33 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	if (dtype_size != 2) {
+	MGLDataType * data_type = dtype_size == 2 ? from_dtype(dtype) : from_compressed_dtype(dtype);
+
+	if (!data_type) {
 		MGLError_Set("invalid dtype");
 		return 0;
 	}
 
-	MGLDataType * data_type = from_dtype(dtype);
+	if (data_type->block_size) {
+		if (!data_type->block_size[components]) {
+			MGLError_Set("the %s dtype does not support %d components", dtype, components);
+			return 0;
+		}
 
-	if (!data_type) {
-		MGLError_Set("invalid dtype");
-		return 0;
+		if (samples) {
+			MGLError_Set("compressed textures cannot be multisample");
+			return 0;
+		}
 	}
 
-	int expected_size = width * components * data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
+	if (data_type->block_size) {
+		expected_size = MGLCompressed_Size(data_type, components, width, height, 0);
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -83,7 +97,7 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	}
 
 	if (buffer_view.len != expected_size) {
-		MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 		if (data != Py_None) {
 			PyBuffer_Release(&buffer_view);
 		}
@@ -117,7 +131,13 @@ PyObject * MGLContext_texture(MGLContext * self, PyObject * args) {
 	} else {
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+		if (data_type->block_size) {
+			gl.CompressedTexImage2D(texture_target, 0, internal_format, width, height, 0, (int)expected_size, buffer_view.buf);
+			// Mipmaps of compressed textures are uploaded level by level.
+			gl.TexParameteri(texture_target, GL_TEXTURE_MAX_LEVEL, 0);
+		} else {
+			gl.TexImage2D(texture_target, 0, internal_format, width, height, 0, base_format, pixel_type, buffer_view.buf);
+		}
 		gl.TexParameteri(texture_target, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		gl.TexParameteri(texture_target, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 	}
@@ -187,7 +207,7 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = width * 4;
+	Py_ssize_t expected_size = (Py_ssize_t)width * 4;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
@@ -205,7 +225,7 @@ PyObject * MGLContext_depth_texture(MGLContext * self, PyObject * args) {
 	}
 
 	if (buffer_view.len != expected_size) {
-		MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 		if (data != Py_None) {
 			PyBuffer_Release(&buffer_view);
 		}
@@ -326,7 +346,17 @@ PyObject * MGLTexture_read(MGLTexture * self, PyObject * args) {
 	width = width > 1 ? width : 1;
 	height = height > 1 ? height : 1;
 
-	int expected_size = width * self->components * self->data_type->size;
+	if (self->data_type->block_size) {
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, width, height, 0);
+		return MGLCompressed_Read(gl, GL_TEXTURE_2D, level, Py_None, 0, compressed_size);
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
@@ -409,13 +439,23 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 	width = width > 1 ? width : 1;
 	height = height > 1 ? height : 1;
 
-	int expected_size = width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
 	int pixel_type = self->data_type->gl_type;
 	int base_format = self->depth ? GL_DEPTH_COMPONENT : self->data_type->base_format[self->components];
 
+	if (self->data_type->block_size) {
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, width, height, 0);
+		return MGLCompressed_Read(gl, GL_TEXTURE_2D, level, data, write_offset, compressed_size);
+	}
+
 	if (Py_TYPE(data) == &MGLBuffer_Type) {
 
 		MGLBuffer * buffer = (MGLBuffer *)data;
@@ -463,19 +503,67 @@ PyObject * MGLTexture_read_into(MGLTexture * self, PyObject * args) {
 	Py_RETURN_NONE;
 }
 
+bool MGLTexture_WriteStrided(const GLMethods & gl, int target, int level, int x, int y, int z, int width, int height, int depth, int format, int pixel_type, Py_ssize_t pixel_size, const Py_buffer * view) {
+	int images = depth > 1 ? depth : 1;
+	Py_ssize_t row_size = pixel_size * width;
+
+	if (view->len != row_size * height * images) {
+		MGLError_Set("data size mismatch %zd != %zd", view->len, row_size * height * images);
+		return false;
+	}
+
+	Py_ssize_t row_stride = 0;
+	Py_ssize_t image_stride = 0;
+
+	// The unpack parameters count whole pixels and whole rows.
+	bool direct = PixelLayout(view, row_size, height, images, &row_stride, &image_stride);
+	direct = direct && row_stride % pixel_size == 0 && row_stride / pixel_size < INT_MAX;
+	direct = direct && image_stride % row_stride == 0 && image_stride / row_stride < INT_MAX;
+
+	const void * pixels = view->buf;
+	char * packed = 0;
+
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+	if (direct) {
+		gl.PixelStorei(GL_UNPACK_ROW_LENGTH, (int)(row_stride / pixel_size));
+		gl.PixelStorei(GL_UNPACK_IMAGE_HEIGHT, (int)(image_stride / row_stride));
+	} else {
+		packed = new char[view->len];
+		PixelGather(packed, view);
+		pixels = packed;
+	}
+
+	if (depth) {
+		gl.TexSubImage3D(target, level, x, y, z, width, height, depth, format, pixel_type, pixels);
+	} else {
+		gl.TexSubImage2D(target, level, x, y, width, height, format, pixel_type, pixels);
+	}
+
+	if (direct) {
+		gl.PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		gl.PixelStorei(GL_UNPACK_IMAGE_HEIGHT, 0);
+	}
+
+	delete[] packed;
+	return true;
+}
+
 PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 	PyObject * data;
 	PyObject * viewport;
 	int level;
 	int alignment;
+	PyObject * stage;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOII",
+		"OOIIO",
 		&data,
 		&viewport,
 		&level,
-		&alignment
+		&alignment,
+		&stage
 	);
 
 	if (!args_ok) {
@@ -487,11 +575,20 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
-	if (level > self->max_level) {
+	// Writing a whole level of a compressed texture defines it, the mipmaps are uploaded this way.
+	bool define = self->data_type->block_size && viewport == Py_None;
+
+	if (level > self->max_level && !define) {
 		MGLError_Set("invalid level");
 		return 0;
 	}
 
+	// Defining a level raises GL_TEXTURE_MAX_LEVEL to it, the chain below it must be defined already.
+	if (level > self->max_level + 1) {
+		MGLError_Set("invalid level = %d, the levels up to %d must be defined first", level, level - 1);
+		return 0;
+	}
+
 	if (self->samples) {
 		MGLError_Set("multisample textures cannot be written directly");
 		return 0;
@@ -539,7 +636,46 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 
 	}
 
-	int expected_size = width * self->components * self->data_type->size;
+	if (self->data_type->block_size) {
+		int level_width = self->width / (1 << level);
+		int level_height = self->height / (1 << level);
+
+		level_width = level_width > 1 ? level_width : 1;
+		level_height = level_height > 1 ? level_height : 1;
+
+		// New levels must still be part of the full mipmap chain.
+		int largest = self->width > self->height ? self->width : self->height;
+
+		if (define && (level > 30 || (1 << level) > largest)) {
+			MGLError_Set("invalid level");
+			return 0;
+		}
+
+		if (!MGLCompressed_CheckBlocks(x, y, width, height, level_width, level_height)) {
+			return 0;
+		}
+
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, width, height, 0);
+		int internal_format = self->data_type->internal_format[self->components];
+
+		if (!MGLCompressed_Write(gl, GL_TEXTURE_2D, level, x, y, 0, width, height, 0, internal_format, define, data, compressed_size)) {
+			return 0;
+		}
+
+		if (level > self->max_level) {
+			self->max_level = level;
+			gl.TexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, level);
+		}
+
+		Py_RETURN_NONE;
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
@@ -563,14 +699,33 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 
 	} else {
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDED_RO);
 		if (get_buffer < 0) {
 			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
+		// Views into a larger image are uploaded in place, the unpack parameters skip the rest of the rows.
+		if (!PyBuffer_IsContiguous(&buffer_view, 'C')) {
+			const GLMethods & gl = self->context->gl;
+
+			gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+			gl.BindTexture(texture_target, self->texture_obj);
+
+			Py_ssize_t pixel_size = self->components * self->data_type->size;
+			bool written = MGLTexture_WriteStrided(gl, texture_target, level, x, y, 0, width, height, 0, format, pixel_type, pixel_size, &buffer_view);
+
+			PyBuffer_Release(&buffer_view);
+
+			if (!written) {
+				return 0;
+			}
+
+			Py_RETURN_NONE;
+		}
+
 		if (buffer_view.len != expected_size) {
-			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
 			}
@@ -583,7 +738,25 @@ PyObject * MGLTexture_write(MGLTexture * self, PyObject * args) {
 		gl.BindTexture(texture_target, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, buffer_view.buf);
+
+		const void * pixels = buffer_view.buf;
+
+		if (stage != Py_None) {
+			MGLBuffer * staging = (MGLBuffer *)stage;
+			Py_ssize_t offset = MGLBuffer_Stage(staging, buffer_view.buf, expected_size);
+
+			// The upload is sourced from the staging buffer, the data can be released right away.
+			if (offset >= 0) {
+				gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, staging->buffer_obj);
+				pixels = (const void *)offset;
+			}
+		}
+
+		gl.TexSubImage2D(texture_target, level, x, y, width, height, format, pixel_type, pixels);
+
+		if (pixels != buffer_view.buf) {
+			gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		}
 
 		PyBuffer_Release(&buffer_view);
 
@@ -634,6 +807,11 @@ PyObject * MGLTexture_build_mipmaps(MGLTexture * self, PyObject * args) {
 		return 0;
 	}
 
+	if (self->data_type->block_size) {
+		MGLError_Set("compressed textures cannot generate mipmaps");
+		return 0;
+	}
+
 	int texture_target = self->samples ? GL_TEXTURE_2D_MULTISAMPLE : GL_TEXTURE_2D;
 
 	const GLMethods & gl = self->context->gl;
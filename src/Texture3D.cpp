@@ -55,7 +55,7 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = width * components * data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * depth;
 
@@ -73,7 +73,7 @@ PyObject * MGLContext_texture3d(MGLContext * self, PyObject * args) {
 	}
 
 	if (buffer_view.len != expected_size) {
-		MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 		if (data != Py_None) {
 			PyBuffer_Release(&buffer_view);
 		}
@@ -166,7 +166,7 @@ PyObject * MGLTexture3D_read(MGLTexture3D * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)self->width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * self->height * self->depth;
 
@@ -210,7 +210,7 @@ PyObject * MGLTexture3D_read_into(MGLTexture3D * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)self->width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * self->height * self->depth;
 
@@ -267,13 +267,15 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 	PyObject * data;
 	PyObject * viewport;
 	int alignment;
+	PyObject * stage;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOI",
+		"OOIO",
 		&data,
 		&viewport,
-		&alignment
+		&alignment,
+		&stage
 	);
 
 	if (!args_ok) {
@@ -329,7 +331,7 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 
 	}
 
-	int expected_size = width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * depth;
 
@@ -352,14 +354,33 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 
 	} else {
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDED_RO);
 		if (get_buffer < 0) {
 			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
+		// Views into a larger image are uploaded in place, the unpack parameters skip the rest of the rows.
+		if (!PyBuffer_IsContiguous(&buffer_view, 'C')) {
+			const GLMethods & gl = self->context->gl;
+
+			gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+			gl.BindTexture(GL_TEXTURE_3D, self->texture_obj);
+
+			Py_ssize_t pixel_size = self->components * self->data_type->size;
+			bool written = MGLTexture_WriteStrided(gl, GL_TEXTURE_3D, 0, x, y, z, width, height, depth, format, pixel_type, pixel_size, &buffer_view);
+
+			PyBuffer_Release(&buffer_view);
+
+			if (!written) {
+				return 0;
+			}
+
+			Py_RETURN_NONE;
+		}
+
 		if (buffer_view.len != expected_size) {
-			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
 			}
@@ -373,7 +394,25 @@ PyObject * MGLTexture3D_write(MGLTexture3D * self, PyObject * args) {
 
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage3D(GL_TEXTURE_3D, 0, x, y, z, width, height, depth, format, pixel_type, buffer_view.buf);
+
+		const void * pixels = buffer_view.buf;
+
+		if (stage != Py_None) {
+			MGLBuffer * staging = (MGLBuffer *)stage;
+			Py_ssize_t offset = MGLBuffer_Stage(staging, buffer_view.buf, expected_size);
+
+			// The upload is sourced from the staging buffer, the data can be released right away.
+			if (offset >= 0) {
+				gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, staging->buffer_obj);
+				pixels = (const void *)offset;
+			}
+		}
+
+		gl.TexSubImage3D(GL_TEXTURE_3D, 0, x, y, z, width, height, depth, format, pixel_type, pixels);
+
+		if (pixels != buffer_view.buf) {
+			gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		}
 
 		PyBuffer_Release(&buffer_view);
 
@@ -43,22 +43,26 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	if (dtype_size != 2) {
+	MGLDataType * data_type = dtype_size == 2 ? from_dtype(dtype) : from_compressed_dtype(dtype);
+
+	if (!data_type) {
 		MGLError_Set("invalid dtype");
 		return 0;
 	}
 
-	MGLDataType * data_type = from_dtype(dtype);
-
-	if (!data_type) {
-		MGLError_Set("invalid dtype");
+	if (data_type->block_size && !data_type->block_size[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
 		return 0;
 	}
 
-	int expected_size = width * components * data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * layers;
 
+	if (data_type->block_size) {
+		expected_size = MGLCompressed_Size(data_type, components, width, height, layers);
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -73,7 +77,7 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 	}
 
 	if (buffer_view.len != expected_size) {
-		MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 		if (data != Py_None) {
 			PyBuffer_Release(&buffer_view);
 		}
@@ -103,7 +107,11 @@ PyObject * MGLContext_texture_array(MGLContext * self, PyObject * args) {
 
     gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
     gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-    gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, base_format, pixel_type, buffer_view.buf);
+    if (data_type->block_size) {
+        gl.CompressedTexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, (int)expected_size, buffer_view.buf);
+    } else {
+        gl.TexImage3D(GL_TEXTURE_2D_ARRAY, 0, internal_format, width, height, layers, 0, base_format, pixel_type, buffer_view.buf);
+    }
     gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     gl.TexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
@@ -166,7 +174,17 @@ PyObject * MGLTextureArray_read(MGLTextureArray * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	if (self->data_type->block_size) {
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, self->width, self->height, self->layers);
+		return MGLCompressed_Read(gl, GL_TEXTURE_2D_ARRAY, 0, Py_None, 0, compressed_size);
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)self->width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * self->height * self->layers;
 
@@ -231,13 +249,23 @@ PyObject * MGLTextureArray_read_into(MGLTextureArray * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)self->width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * self->height * self->layers;
 
 	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
 
+	if (self->data_type->block_size) {
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, self->width, self->height, self->layers);
+		return MGLCompressed_Read(gl, GL_TEXTURE_2D_ARRAY, 0, data, write_offset, compressed_size);
+	}
+
 	if (Py_TYPE(data) == &MGLBuffer_Type) {
 
 		MGLBuffer * buffer = (MGLBuffer *)data;
@@ -289,13 +317,15 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 	PyObject * data;
 	PyObject * viewport;
 	int alignment;
+	PyObject * stage;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"OOI",
+		"OOIO",
 		&data,
 		&viewport,
-		&alignment
+		&alignment,
+		&stage
 	);
 
 	if (!args_ok) {
@@ -351,7 +381,27 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 
 	}
 
-	int expected_size = width * self->components * self->data_type->size;
+	if (self->data_type->block_size) {
+		if (!MGLCompressed_CheckBlocks(x, y, width, height, self->width, self->height)) {
+			return 0;
+		}
+
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, width, height, layers);
+		int internal_format = self->data_type->internal_format[self->components];
+
+		if (!MGLCompressed_Write(gl, GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, internal_format, false, data, compressed_size)) {
+			return 0;
+		}
+
+		Py_RETURN_NONE;
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * layers;
 
@@ -374,14 +424,33 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 
 	} else {
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDED_RO);
 		if (get_buffer < 0) {
 			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
+		// Views into a larger image are uploaded in place, the unpack parameters skip the rest of the rows.
+		if (!PyBuffer_IsContiguous(&buffer_view, 'C')) {
+			const GLMethods & gl = self->context->gl;
+
+			gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+			gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
+
+			Py_ssize_t pixel_size = self->components * self->data_type->size;
+			bool written = MGLTexture_WriteStrided(gl, GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, format, pixel_type, pixel_size, &buffer_view);
+
+			PyBuffer_Release(&buffer_view);
+
+			if (!written) {
+				return 0;
+			}
+
+			Py_RETURN_NONE;
+		}
+
 		if (buffer_view.len != expected_size) {
-			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 			if (data != Py_None) {
 				PyBuffer_Release(&buffer_view);
 			}
@@ -394,7 +463,25 @@ PyObject * MGLTextureArray_write(MGLTextureArray * self, PyObject * args) {
 		gl.BindTexture(GL_TEXTURE_2D_ARRAY, self->texture_obj);
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, format, pixel_type, buffer_view.buf);
+
+		const void * pixels = buffer_view.buf;
+
+		if (stage != Py_None) {
+			MGLBuffer * staging = (MGLBuffer *)stage;
+			Py_ssize_t offset = MGLBuffer_Stage(staging, buffer_view.buf, expected_size);
+
+			// The upload is sourced from the staging buffer, the data can be released right away.
+			if (offset >= 0) {
+				gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, staging->buffer_obj);
+				pixels = (const void *)offset;
+			}
+		}
+
+		gl.TexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, x, y, z, width, height, layers, format, pixel_type, pixels);
+
+		if (pixels != buffer_view.buf) {
+			gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		}
 
 		PyBuffer_Release(&buffer_view);
 
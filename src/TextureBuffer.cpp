@@ -0,0 +1,256 @@
+#include "Types.hpp"
+
+#include "InlineMethods.hpp"
+#include "BufferFormat.hpp"
+
+// The texture dtype of a single buffer format node, 0 for types without a texture buffer format.
+const char * TextureBuffer_dtype(const FormatNode * node) {
+	switch (node->type) {
+		case GL_FLOAT:
+			return "f4";
+		case GL_HALF_FLOAT:
+			return "f2";
+		case GL_UNSIGNED_BYTE:
+			return node->normalize ? "f1" : "u1";
+		case GL_UNSIGNED_SHORT:
+			return node->normalize ? 0 : "u2";
+		case GL_UNSIGNED_INT:
+			return node->normalize ? 0 : "u4";
+		case GL_BYTE:
+			return node->normalize ? 0 : "i1";
+		case GL_SHORT:
+			return node->normalize ? 0 : "i2";
+		case GL_INT:
+			return node->normalize ? 0 : "i4";
+	}
+	return 0;
+}
+
+PyObject * MGLContext_texture_buffer(MGLContext * self, PyObject * args) {
+	MGLBuffer * buffer;
+	const char * format;
+	Py_ssize_t offset;
+	Py_ssize_t size;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!snn",
+		&MGLBuffer_Type,
+		&buffer,
+		&format,
+		&offset,
+		&size
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	FormatIterator it = FormatIterator(format);
+	FormatInfo format_info = it.info();
+
+	if (!format_info.valid || format_info.divisor || format_info.nodes != 1) {
+		MGLError_Set("invalid format");
+		return 0;
+	}
+
+	FormatNode * node = it.next();
+	const char * dtype = node->type ? TextureBuffer_dtype(node) : 0;
+
+	if (!dtype) {
+		MGLError_Set("the format %s cannot be used for texture buffers", format);
+		return 0;
+	}
+
+	if (node->count < 1 || node->count > 4 || (node->count == 3 && node->size != 12)) {
+		MGLError_Set("the format %s cannot be used for texture buffers, three components require 32-bit types", format);
+		return 0;
+	}
+
+	if (size < 0) {
+		size = buffer->size - offset;
+	}
+
+	if (offset < 0 || size < 1 || offset + size > buffer->size) {
+		MGLError_Set("out of range offset = %zd or size = %zd", offset, size);
+		return 0;
+	}
+
+	if (size % node->size) {
+		MGLError_Set("the size = %zd is not a multiple of the texel size = %d", size, node->size);
+		return 0;
+	}
+
+	const GLMethods & gl = self->gl;
+
+	bool whole = offset == 0 && size == buffer->size;
+
+	if (!gl.TexBuffer || (!whole && !gl.TexBufferRange)) {
+		MGLError_Set(whole ? "texture buffers are not supported" : "texture buffer ranges require OpenGL 4.3");
+		return 0;
+	}
+
+	if (!whole) {
+		int offset_alignment = 1;
+		gl.GetIntegerv(GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT, &offset_alignment);
+
+		if (offset_alignment > 0 && offset % offset_alignment) {
+			MGLError_Set("the offset = %zd is not a multiple of %d", offset, offset_alignment);
+			return 0;
+		}
+	}
+
+	int max_texels = 0;
+	gl.GetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &max_texels);
+
+	if (max_texels > 0 && size / node->size > max_texels) {
+		MGLError_Set("the texture buffer has %zd texels, the limit is %d", size / node->size, max_texels);
+		return 0;
+	}
+
+	MGLDataType * data_type = from_dtype(dtype);
+	int internal_format = data_type->internal_format[node->count];
+
+	MGLTextureBuffer * texture = (MGLTextureBuffer *)MGLTextureBuffer_Type.tp_alloc(&MGLTextureBuffer_Type, 0);
+
+	texture->texture_obj = 0;
+	gl.GenTextures(1, (GLuint *)&texture->texture_obj);
+
+	if (!texture->texture_obj) {
+		MGLError_Set("cannot create texture");
+		Py_DECREF(texture);
+		return 0;
+	}
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_BUFFER, texture->texture_obj);
+
+	if (whole) {
+		gl.TexBuffer(GL_TEXTURE_BUFFER, internal_format, buffer->buffer_obj);
+	} else {
+		gl.TexBufferRange(GL_TEXTURE_BUFFER, internal_format, buffer->buffer_obj, offset, size);
+	}
+
+	texture->internal_format = internal_format;
+	texture->components = node->count;
+	texture->texel_size = node->size;
+	texture->offset = offset;
+	texture->size = size;
+
+	Py_INCREF(buffer);
+	texture->buffer = buffer;
+
+	Py_INCREF(self);
+	texture->context = self;
+
+	Py_INCREF(texture);
+
+	PyObject * result = PyTuple_New(6);
+	PyTuple_SET_ITEM(result, 0, (PyObject *)texture);
+	PyTuple_SET_ITEM(result, 1, PyLong_FromSsize_t(size));
+	PyTuple_SET_ITEM(result, 2, PyLong_FromSsize_t(offset));
+	PyTuple_SET_ITEM(result, 3, PyLong_FromLong(node->count));
+	PyTuple_SET_ITEM(result, 4, PyUnicode_FromString(dtype));
+	PyTuple_SET_ITEM(result, 5, PyLong_FromLong(texture->texture_obj));
+	return result;
+}
+
+PyObject * MGLTextureBuffer_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
+	MGLTextureBuffer * self = (MGLTextureBuffer *)type->tp_alloc(type, 0);
+
+	if (self) {
+	}
+
+	return (PyObject *)self;
+}
+
+void MGLTextureBuffer_tp_dealloc(MGLTextureBuffer * self) {
+	MGLTextureBuffer_Type.tp_free((PyObject *)self);
+}
+
+PyObject * MGLTextureBuffer_use(MGLTextureBuffer * self, PyObject * args) {
+	int index;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"I",
+		&index
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+	gl.ActiveTexture(GL_TEXTURE0 + index);
+	gl.BindTexture(GL_TEXTURE_BUFFER, self->texture_obj);
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureBuffer_release(MGLTextureBuffer * self) {
+	MGLTextureBuffer_Invalidate(self);
+	Py_RETURN_NONE;
+}
+
+PyMethodDef MGLTextureBuffer_tp_methods[] = {
+	{"use", (PyCFunction)MGLTextureBuffer_use, METH_VARARGS, 0},
+	{"release", (PyCFunction)MGLTextureBuffer_release, METH_NOARGS, 0},
+	{0},
+};
+
+PyTypeObject MGLTextureBuffer_Type = {
+	PyVarObject_HEAD_INIT(0, 0)
+	"mgl.TextureBuffer",                                    // tp_name
+	sizeof(MGLTextureBuffer),                               // tp_basicsize
+	0,                                                      // tp_itemsize
+	(destructor)MGLTextureBuffer_tp_dealloc,                // tp_dealloc
+	0,                                                      // tp_print
+	0,                                                      // tp_getattr
+	0,                                                      // tp_setattr
+	0,                                                      // tp_reserved
+	0,                                                      // tp_repr
+	0,                                                      // tp_as_number
+	0,                                                      // tp_as_sequence
+	0,                                                      // tp_as_mapping
+	0,                                                      // tp_hash
+	0,                                                      // tp_call
+	0,                                                      // tp_str
+	0,                                                      // tp_getattro
+	0,                                                      // tp_setattro
+	0,                                                      // tp_as_buffer
+	Py_TPFLAGS_DEFAULT,                                     // tp_flags
+	0,                                                      // tp_doc
+	0,                                                      // tp_traverse
+	0,                                                      // tp_clear
+	0,                                                      // tp_richcompare
+	0,                                                      // tp_weaklistoffset
+	0,                                                      // tp_iter
+	0,                                                      // tp_iternext
+	MGLTextureBuffer_tp_methods,                            // tp_methods
+	0,                                                      // tp_members
+	0,                                                      // tp_getset
+	0,                                                      // tp_base
+	0,                                                      // tp_dict
+	0,                                                      // tp_descr_get
+	0,                                                      // tp_descr_set
+	0,                                                      // tp_dictoffset
+	0,                                                      // tp_init
+	0,                                                      // tp_alloc
+	MGLTextureBuffer_tp_new,                                // tp_new
+};
+
+void MGLTextureBuffer_Invalidate(MGLTextureBuffer * texture) {
+	if (Py_TYPE(texture) == &MGLInvalidObject_Type) {
+		return;
+	}
+
+	const GLMethods & gl = texture->context->gl;
+	gl.DeleteTextures(1, (GLuint *)&texture->texture_obj);
+
+	Py_DECREF(texture->buffer);
+	Py_DECREF(texture->context);
+
+	Py_TYPE(texture) = &MGLInvalidObject_Type;
+	Py_DECREF(texture);
+}
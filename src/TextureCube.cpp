@@ -2,6 +2,8 @@
 
 #include "InlineMethods.hpp"
 
+#include <climits>
+
 PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	int width;
 	int height;
@@ -41,22 +43,26 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 		return 0;
 	}
 
-	if (dtype_size != 2) {
+	MGLDataType * data_type = dtype_size == 2 ? from_dtype(dtype) : from_compressed_dtype(dtype);
+
+	if (!data_type) {
 		MGLError_Set("invalid dtype");
 		return 0;
 	}
 
-	MGLDataType * data_type = from_dtype(dtype);
-
-	if (!data_type) {
-		MGLError_Set("invalid dtype");
+	if (data_type->block_size && !data_type->block_size[components]) {
+		MGLError_Set("the %s dtype does not support %d components", dtype, components);
 		return 0;
 	}
 
-	int expected_size = width * components * data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)width * components * data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height * 6;
 
+	if (data_type->block_size) {
+		expected_size = MGLCompressed_Size(data_type, components, width, height, 0) * 6;
+	}
+
 	Py_buffer buffer_view;
 
 	if (data != Py_None) {
@@ -71,7 +77,7 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	}
 
 	if (buffer_view.len != expected_size) {
-		MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+		MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 		if (data != Py_None) {
 			PyBuffer_Release(&buffer_view);
 		}
@@ -98,6 +104,8 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 	gl.ActiveTexture(GL_TEXTURE0 + self->default_texture_unit);
 	gl.BindTexture(GL_TEXTURE_CUBE_MAP, texture->texture_obj);
 
+	int face_size = (int)(expected_size / 6);
+
 	if (data == Py_None) {
 		expected_size = 0;
 	}
@@ -113,12 +121,20 @@ PyObject * MGLContext_texture_cube(MGLContext * self, PyObject * args) {
 
 	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[0]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[1]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[2]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[3]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[4]);
-	gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[5]);
+	if (data_type->block_size) {
+		for (int face = 0; face < 6; ++face) {
+			gl.CompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, internal_format, width, height, 0, face_size, ptr[face]);
+		}
+		// Mipmaps of compressed textures are uploaded level by level.
+		gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, 0);
+	} else {
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[0]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_X, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[1]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[2]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Y, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[3]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[4]);
+		gl.TexImage2D(GL_TEXTURE_CUBE_MAP_NEGATIVE_Z, 0, internal_format, width, height, 0, base_format, pixel_type, ptr[5]);
+	}
 	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
@@ -185,7 +201,17 @@ PyObject * MGLTextureCube_read(MGLTextureCube * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	if (self->data_type->block_size) {
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, self->width, self->height, 0);
+		return MGLCompressed_Read(gl, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, Py_None, 0, compressed_size);
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)self->width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * self->height;
 
@@ -236,13 +262,23 @@ PyObject * MGLTextureCube_read_into(MGLTextureCube * self, PyObject * args) {
 		return 0;
 	}
 
-	int expected_size = self->width * self->components * self->data_type->size;
+	Py_ssize_t expected_size = (Py_ssize_t)self->width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * self->height;
 
 	int pixel_type = self->data_type->gl_type;
 	int format = self->data_type->base_format[self->components];
 
+	if (self->data_type->block_size) {
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, self->width, self->height, 0);
+		return MGLCompressed_Read(gl, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, data, write_offset, compressed_size);
+	}
+
 	if (Py_TYPE(data) == &MGLBuffer_Type) {
 
 		MGLBuffer * buffer = (MGLBuffer *)data;
@@ -294,14 +330,16 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 	PyObject * data;
 	PyObject * viewport;
 	int alignment;
+	PyObject * stage;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"iOOI",
+		"iOOIO",
 		&face,
 		&data,
 		&viewport,
-		&alignment
+		&alignment,
+		&stage
 	);
 
 	if (!args_ok) {
@@ -357,7 +395,27 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 
 	}
 
-	int expected_size = width * self->components * self->data_type->size;
+	if (self->data_type->block_size) {
+		if (!MGLCompressed_CheckBlocks(x, y, width, height, self->width, self->height)) {
+			return 0;
+		}
+
+		const GLMethods & gl = self->context->gl;
+
+		gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+		gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+
+		Py_ssize_t compressed_size = MGLCompressed_Size(self->data_type, self->components, width, height, 0);
+		int internal_format = self->data_type->internal_format[self->components];
+
+		if (!MGLCompressed_Write(gl, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, 0, width, height, 0, internal_format, false, data, compressed_size)) {
+			return 0;
+		}
+
+		Py_RETURN_NONE;
+	}
+
+	Py_ssize_t expected_size = (Py_ssize_t)width * self->components * self->data_type->size;
 	expected_size = (expected_size + alignment - 1) / alignment * alignment;
 	expected_size = expected_size * height;
 
@@ -387,14 +445,33 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 
 	} else {
 
-		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_STRIDED_RO);
 		if (get_buffer < 0) {
 			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
 			return 0;
 		}
 
+		// Views into a larger image are uploaded in place, the unpack parameters skip the rest of the rows.
+		if (!PyBuffer_IsContiguous(&buffer_view, 'C')) {
+			const GLMethods & gl = self->context->gl;
+
+			gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+			gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+
+			Py_ssize_t pixel_size = self->components * self->data_type->size;
+			bool written = MGLTexture_WriteStrided(gl, GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, 0, width, height, 0, format, pixel_type, pixel_size, &buffer_view);
+
+			PyBuffer_Release(&buffer_view);
+
+			if (!written) {
+				return 0;
+			}
+
+			Py_RETURN_NONE;
+		}
+
 		if (buffer_view.len != expected_size) {
-			MGLError_Set("data size mismatch %d != %d", buffer_view.len, expected_size);
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
 			PyBuffer_Release(&buffer_view);
 			return 0;
 		}
@@ -406,14 +483,349 @@ PyObject * MGLTextureCube_write(MGLTextureCube * self, PyObject * args) {
 
 		gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
 		gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
-		gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, width, height, format, pixel_type, buffer_view.buf);
 
+		const void * pixels = buffer_view.buf;
+
+		if (stage != Py_None) {
+			MGLBuffer * staging = (MGLBuffer *)stage;
+			Py_ssize_t offset = MGLBuffer_Stage(staging, buffer_view.buf, expected_size);
+
+			// The upload is sourced from the staging buffer, the data can be released right away.
+			if (offset >= 0) {
+				gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, staging->buffer_obj);
+				pixels = (const void *)offset;
+			}
+		}
+
+		gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, 0, x, y, width, height, format, pixel_type, pixels);
+
+		if (pixels != buffer_view.buf) {
+			gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		}
+
+		PyBuffer_Release(&buffer_view);
+	}
+
+	Py_RETURN_NONE;
+}
+
+// The size of the six faces of a mip level, the rows of every face are padded to the alignment.
+Py_ssize_t MGLTextureCube_LevelSize(MGLTextureCube * self, int level, int alignment) {
+	int width = self->width >> level;
+	int height = self->height >> level;
+
+	width = width > 1 ? width : 1;
+	height = height > 1 ? height : 1;
+
+	if (self->data_type->block_size) {
+		return MGLCompressed_Size(self->data_type, self->components, width, height, 0) * 6;
+	}
+
+	Py_ssize_t row_size = (Py_ssize_t)width * self->components * self->data_type->size;
+	row_size = (row_size + alignment - 1) / alignment * alignment;
+	return row_size * height * 6;
+}
+
+// Compressed levels are defined by writing them, any level of the full chain can be written.
+bool MGLTextureCube_CheckLevels(MGLTextureCube * self, int level, int levels, int alignment, bool define) {
+	if (alignment != 1 && alignment != 2 && alignment != 4 && alignment != 8) {
+		MGLError_Set("the alignment must be 1, 2, 4 or 8");
+		return false;
+	}
+
+	int max_level = 0;
+
+	while ((self->width >> (max_level + 1)) || (self->height >> (max_level + 1))) {
+		++max_level;
+	}
+
+	if (!define) {
+		max_level = max_level < self->max_level ? max_level : self->max_level;
+	}
+
+	if (level < 0 || levels < 1 || level + levels - 1 > max_level) {
+		MGLError_Set("invalid level = %d or levels = %d, the highest level is %d", level, levels, max_level);
+		return false;
+	}
+
+	// GL_TEXTURE_MAX_LEVEL is raised over the new levels, the chain below them must be defined already.
+	if (define && level > self->max_level + 1) {
+		MGLError_Set("invalid level = %d, the levels up to %d must be defined first", level, level - 1);
+		return false;
+	}
+
+	return true;
+}
+
+// OpenGL 4.5 addresses the faces of a cube map as six layers, a whole level takes a single call.
+bool MGLTextureCube_DirectStateAccess(MGLTextureCube * self, Py_ssize_t level_size) {
+	const GLMethods & gl = self->context->gl;
+	return self->context->version_code >= 450 && gl.TextureSubImage3D && gl.GetTextureImage && level_size <= INT_MAX;
+}
+
+PyObject * MGLTextureCube_write_all(MGLTextureCube * self, PyObject * args) {
+	PyObject * data;
+	int level;
+	int levels;
+	int alignment;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OiiI",
+		&data,
+		&level,
+		&levels,
+		&alignment
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!MGLTextureCube_CheckLevels(self, level, levels, alignment, self->data_type->block_size != 0)) {
+		return 0;
+	}
+
+	Py_ssize_t expected_size = 0;
+
+	for (int i = 0; i < levels; ++i) {
+		expected_size += MGLTextureCube_LevelSize(self, level + i, alignment);
+	}
+
+	Py_buffer buffer_view;
+	const char * ptr = 0;
+
+	const GLMethods & gl = self->context->gl;
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		MGLBuffer * buffer = (MGLBuffer *)data;
+
+		if (buffer->size < expected_size) {
+			MGLError_Set("the buffer is too small %zd < %zd", buffer->size, expected_size);
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer->buffer_obj);
+	} else {
+		int get_buffer = PyObject_GetBuffer(data, &buffer_view, PyBUF_SIMPLE);
+		if (get_buffer < 0) {
+			MGLError_Set("data (%s) does not support buffer interface", Py_TYPE(data)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len != expected_size) {
+			MGLError_Set("data size mismatch %zd != %zd", buffer_view.len, expected_size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		ptr = (const char *)buffer_view.buf;
+	}
+
+	int pixel_type = self->data_type->gl_type;
+	int format = self->data_type->base_format[self->components];
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	for (int i = level; i < level + levels; ++i) {
+		int width = self->width >> i;
+		int height = self->height >> i;
+
+		width = width > 1 ? width : 1;
+		height = height > 1 ? height : 1;
+
+		Py_ssize_t level_size = MGLTextureCube_LevelSize(self, i, alignment);
+
+		if (self->data_type->block_size) {
+			int internal_format = self->data_type->internal_format[self->components];
+			for (int face = 0; face < 6; ++face) {
+				const char * face_ptr = ptr + level_size / 6 * face;
+				gl.CompressedTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, i, internal_format, width, height, 0, (int)(level_size / 6), face_ptr);
+			}
+		} else if (MGLTextureCube_DirectStateAccess(self, level_size)) {
+			gl.TextureSubImage3D(self->texture_obj, i, 0, 0, 0, width, height, 6, format, pixel_type, ptr);
+		} else {
+			for (int face = 0; face < 6; ++face) {
+				const char * face_ptr = ptr + level_size / 6 * face;
+				gl.TexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, i, 0, 0, width, height, format, pixel_type, face_ptr);
+			}
+		}
+
+		ptr += level_size;
+	}
+
+	if (level + levels - 1 > self->max_level) {
+		self->max_level = level + levels - 1;
+		gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, self->max_level);
+	}
+
+	if (Py_TYPE(data) == &MGLBuffer_Type) {
+		gl.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	} else {
+		PyBuffer_Release(&buffer_view);
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLTextureCube_read_all(MGLTextureCube * self, PyObject * args) {
+	PyObject * out;
+	int level;
+	int levels;
+	int alignment;
+	Py_ssize_t write_offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"OiiIn",
+		&out,
+		&level,
+		&levels,
+		&alignment,
+		&write_offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (!MGLTextureCube_CheckLevels(self, level, levels, alignment, false)) {
+		return 0;
+	}
+
+	Py_ssize_t expected_size = 0;
+
+	for (int i = 0; i < levels; ++i) {
+		expected_size += MGLTextureCube_LevelSize(self, level + i, alignment);
+	}
+
+	if (write_offset < 0) {
+		MGLError_Set("invalid write_offset = %zd", write_offset);
+		return 0;
+	}
+
+	Py_buffer buffer_view;
+	PyObject * result = 0;
+	char * ptr = 0;
+
+	const GLMethods & gl = self->context->gl;
+
+	if (out == Py_None) {
+		result = PyBytes_FromStringAndSize(0, expected_size);
+		ptr = PyBytes_AS_STRING(result);
+	} else if (Py_TYPE(out) == &MGLBuffer_Type) {
+		MGLBuffer * buffer = (MGLBuffer *)out;
+
+		if (buffer->size < write_offset + expected_size) {
+			MGLError_Set("the buffer is too small");
+			return 0;
+		}
+
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, buffer->buffer_obj);
+		ptr = (char *)write_offset;
+	} else {
+		int get_buffer = PyObject_GetBuffer(out, &buffer_view, PyBUF_WRITABLE);
+		if (get_buffer < 0) {
+			MGLError_Set("the buffer (%s) does not support buffer interface", Py_TYPE(out)->tp_name);
+			return 0;
+		}
+
+		if (buffer_view.len < write_offset + expected_size) {
+			MGLError_Set("the buffer is too small");
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		ptr = (char *)buffer_view.buf + write_offset;
+	}
+
+	int pixel_type = self->data_type->gl_type;
+	int format = self->data_type->base_format[self->components];
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+	gl.PixelStorei(GL_PACK_ALIGNMENT, alignment);
+	gl.PixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+
+	for (int i = level; i < level + levels; ++i) {
+		Py_ssize_t level_size = MGLTextureCube_LevelSize(self, i, alignment);
+
+		if (self->data_type->block_size) {
+			for (int face = 0; face < 6; ++face) {
+				gl.GetCompressedTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, i, ptr + level_size / 6 * face);
+			}
+		} else if (MGLTextureCube_DirectStateAccess(self, level_size)) {
+			gl.GetTextureImage(self->texture_obj, i, format, pixel_type, (int)level_size, ptr);
+		} else {
+			for (int face = 0; face < 6; ++face) {
+				gl.GetTexImage(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face, i, format, pixel_type, ptr + level_size / 6 * face);
+			}
+		}
+
+		ptr += level_size;
+	}
+
+	if (out == Py_None) {
+		return result;
+	}
+
+	if (Py_TYPE(out) == &MGLBuffer_Type) {
+		gl.BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	} else {
 		PyBuffer_Release(&buffer_view);
 	}
 
 	Py_RETURN_NONE;
 }
 
+PyObject * MGLTextureCube_build_mipmaps(MGLTextureCube * self, PyObject * args) {
+	int base = 0;
+	int max = 1000;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"II",
+		&base,
+		&max
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	if (base > self->max_level) {
+		MGLError_Set("invalid base");
+		return 0;
+	}
+
+	if (self->data_type->block_size) {
+		MGLError_Set("compressed textures cannot generate mipmaps");
+		return 0;
+	}
+
+	const GLMethods & gl = self->context->gl;
+
+	gl.ActiveTexture(GL_TEXTURE0 + self->context->default_texture_unit);
+	gl.BindTexture(GL_TEXTURE_CUBE_MAP, self->texture_obj);
+
+	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_BASE_LEVEL, base);
+	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_LEVEL, max);
+
+	gl.GenerateMipmap(GL_TEXTURE_CUBE_MAP);
+
+	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	gl.TexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+	self->min_filter = GL_LINEAR_MIPMAP_LINEAR;
+	self->mag_filter = GL_LINEAR;
+	self->max_level = max;
+
+	Py_RETURN_NONE;
+}
+
 PyObject * MGLTextureCube_use(MGLTextureCube * self, PyObject * args) {
 	int index;
 
@@ -441,10 +853,12 @@ PyObject * MGLTextureCube_release(MGLTextureCube * self) {
 
 PyMethodDef MGLTextureCube_tp_methods[] = {
 	{"write", (PyCFunction)MGLTextureCube_write, METH_VARARGS, 0},
+	{"write_all", (PyCFunction)MGLTextureCube_write_all, METH_VARARGS, 0},
 	{"use", (PyCFunction)MGLTextureCube_use, METH_VARARGS, 0},
-//	{"build_mipmaps", (PyCFunction)MGLTextureCube_build_mipmaps, METH_VARARGS, 0},
+	{"build_mipmaps", (PyCFunction)MGLTextureCube_build_mipmaps, METH_VARARGS, 0},
 	{"read", (PyCFunction)MGLTextureCube_read, METH_VARARGS, 0},
 	{"read_into", (PyCFunction)MGLTextureCube_read_into, METH_VARARGS, 0},
+	{"read_all", (PyCFunction)MGLTextureCube_read_all, METH_VARARGS, 0},
 	{"release", (PyCFunction)MGLTextureCube_release, METH_NOARGS, 0},
 	{0},
 };
@@ -37,6 +37,7 @@ struct MGLAttribute;
 struct MGLBuffer;
 struct MGLComputeShader;
 struct MGLContext;
+struct MGLFence;
 struct MGLFramebuffer;
 struct MGLInvalidObject;
 struct MGLProgram;
@@ -45,6 +46,7 @@ struct MGLTexture;
 struct MGLTexture3D;
 struct MGLTextureArray;
 struct MGLTextureCube;
+struct MGLTextureBuffer;
 struct MGLUniform;
 struct MGLUniformBlock;
 struct MGLVertexArray;
@@ -55,6 +57,9 @@ struct MGLDataType {
 	int * internal_format;
 	int gl_type;
 	int size;
+
+	// Bytes per 4x4 block by the number of components, null for uncompressed types.
+	int * block_size;
 };
 
 struct MGLAttribute {
@@ -89,6 +94,26 @@ struct MGLBuffer {
 
 	Py_ssize_t size;
 	bool dynamic;
+
+	// Only set for stream buffers, the storage is persistently mapped.
+	char * persistent_map;
+	GLsync * fences;
+
+	int regions;
+	int region;
+	Py_ssize_t region_size;
+	Py_ssize_t region_cursor;
+
+	// Regions written since the last advance, they are fenced together by the next advance.
+	int frame_regions;
+
+	// Number of buffer views on the persistent map, the buffer cannot be released while any is alive.
+	int persistent_exports;
+
+	// Range and access of the next buffer request, only set by map.
+	Py_ssize_t map_offset;
+	Py_ssize_t map_size;
+	int map_access;
 };
 
 struct MGLComputeShader {
@@ -118,6 +143,8 @@ struct MGLContext {
 	int default_texture_unit;
 	float max_anisotropy;
 
+	int uniform_buffer_offset_alignment;
+
 	int enable_flags;
 	int front_face;
 
@@ -181,6 +208,14 @@ struct MGLProgram {
 	int num_varyings;
 };
 
+struct MGLFence {
+	PyObject_HEAD
+
+	MGLContext * context;
+
+	GLsync sync;
+};
+
 enum MGLQueryKeys {
 	SAMPLES_PASSED,
 	ANY_SAMPLES_PASSED,
@@ -330,6 +365,22 @@ struct MGLTextureCube {
 	float anisotropy;
 };
 
+struct MGLTextureBuffer {
+	PyObject_HEAD
+
+	MGLContext * context;
+	MGLBuffer * buffer;
+
+	int texture_obj;
+	int internal_format;
+
+	int components;
+	int texel_size;
+
+	Py_ssize_t offset;
+	Py_ssize_t size;
+};
+
 struct MGLUniform {
 	PyObject_HEAD
 
@@ -351,6 +402,17 @@ struct MGLUniform {
 	bool matrix;
 };
 
+struct MGLUniformBlockMember {
+	int offset;
+	int array_length;
+	int array_stride;
+	int matrix_stride;
+	int columns;
+	int rows;
+	char kind;
+	bool row_major;
+};
+
 struct MGLUniformBlock {
 	PyObject_HEAD
 
@@ -360,6 +422,10 @@ struct MGLUniformBlock {
 
 	int index;
 	int size;
+
+	MGLUniformBlockMember * members;
+	PyObject * member_lookup;
+	int num_members;
 };
 
 struct MGLVertexArray {
@@ -402,16 +468,19 @@ struct MGLSampler {
 };
 
 MGLDataType * from_dtype(const char * dtype);
+MGLDataType * from_compressed_dtype(const char * dtype);
 
 void MGLAttribute_Invalidate(MGLAttribute * attribute);
 void MGLBuffer_Invalidate(MGLBuffer * buffer);
 void MGLComputeShader_Invalidate(MGLComputeShader * program);
 void MGLContext_Invalidate(MGLContext * context);
 void MGLFramebuffer_Invalidate(MGLFramebuffer * framebuffer);
+void MGLFence_Invalidate(MGLFence * fence);
 void MGLProgram_Invalidate(MGLProgram * program);
 void MGLRenderbuffer_Invalidate(MGLRenderbuffer * renderbuffer);
 void MGLTexture3D_Invalidate(MGLTexture3D * texture);
 void MGLTextureCube_Invalidate(MGLTextureCube * texture);
+void MGLTextureBuffer_Invalidate(MGLTextureBuffer * texture);
 void MGLTexture_Invalidate(MGLTexture * texture);
 void MGLTextureArray_Invalidate(MGLTextureArray * texture);
 void MGLUniform_Invalidate(MGLUniform * uniform);
@@ -425,10 +494,24 @@ void MGLVertexArray_Complete(MGLVertexArray * vertex_array);
 
 void MGLContext_Initialize(MGLContext * self);
 
+Py_ssize_t MGLBuffer_Stage(MGLBuffer * self, const void * data, Py_ssize_t size);
+
+// Uploads a strided view into the bound texture, a depth of 0 selects TexSubImage2D.
+// The strides are passed as GL_UNPACK_ROW_LENGTH and GL_UNPACK_IMAGE_HEIGHT when possible, otherwise the view is gathered.
+bool MGLTexture_WriteStrided(const GLMethods & gl, int target, int level, int x, int y, int z, int width, int height, int depth, int format, int pixel_type, Py_ssize_t pixel_size, const Py_buffer * view);
+
+// Compressed images are stored as 4x4 blocks, every function expects the texture to be bound.
+// A depth of 0 selects the 2D variants, define creates the level instead of updating a part of it.
+Py_ssize_t MGLCompressed_Size(MGLDataType * data_type, int components, int width, int height, int depth);
+bool MGLCompressed_CheckBlocks(int x, int y, int width, int height, int level_width, int level_height);
+bool MGLCompressed_Write(const GLMethods & gl, int target, int level, int x, int y, int z, int width, int height, int depth, int internal_format, bool define, PyObject * data, Py_ssize_t expected_size);
+PyObject * MGLCompressed_Read(const GLMethods & gl, int target, int level, PyObject * out, Py_ssize_t write_offset, Py_ssize_t expected_size);
+
 extern PyTypeObject MGLAttribute_Type;
 extern PyTypeObject MGLBuffer_Type;
 extern PyTypeObject MGLComputeShader_Type;
 extern PyTypeObject MGLContext_Type;
+extern PyTypeObject MGLFence_Type;
 extern PyTypeObject MGLFramebuffer_Type;
 extern PyTypeObject MGLInvalidObject_Type;
 extern PyTypeObject MGLProgram_Type;
@@ -437,6 +520,7 @@ extern PyTypeObject MGLRenderbuffer_Type;
 extern PyTypeObject MGLScope_Type;
 extern PyTypeObject MGLTexture3D_Type;
 extern PyTypeObject MGLTextureCube_Type;
+extern PyTypeObject MGLTextureBuffer_Type;
 extern PyTypeObject MGLTexture_Type;
 extern PyTypeObject MGLTextureArray_Type;
 extern PyTypeObject MGLUniformBlock_Type;
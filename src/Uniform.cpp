@@ -491,6 +491,9 @@ void MGLUniform_Complete(MGLUniform * self, const GLMethods & gl) {
 			break;
 
 		case GL_SAMPLER_CUBE:
+		case GL_SAMPLER_BUFFER:
+		case GL_INT_SAMPLER_BUFFER:
+		case GL_UNSIGNED_INT_SAMPLER_BUFFER:
 			self->matrix = false;
 			self->dimension = 1;
 			self->element_size = 4;
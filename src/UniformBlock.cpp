@@ -1,5 +1,7 @@
 #include "Types.hpp"
 
+#include "InlineMethods.hpp"
+
 PyObject * MGLUniformBlock_tp_new(PyTypeObject * type, PyObject * args, PyObject * kwargs) {
 	MGLUniformBlock * self = (MGLUniformBlock *)type->tp_alloc(type, 0);
 
@@ -10,11 +12,289 @@ PyObject * MGLUniformBlock_tp_new(PyTypeObject * type, PyObject * args, PyObject
 }
 
 void MGLUniformBlock_tp_dealloc(MGLUniformBlock * self) {
-
+	delete[] self->members;
+	Py_XDECREF(self->member_lookup);
 	Py_TYPE(self)->tp_free((PyObject *)self);
 }
 
+inline double MGLUniformBlock_ReadScalar(const char * ptr, char format) {
+	switch (format) {
+		case 'f': return *(float *)ptr;
+		case 'd': return *(double *)ptr;
+		case 'b': return *(signed char *)ptr;
+		case 'B': return *(unsigned char *)ptr;
+		case '?': return *(bool *)ptr;
+		case 'h': return *(short *)ptr;
+		case 'H': return *(unsigned short *)ptr;
+		case 'i': return *(int *)ptr;
+		case 'I': return *(unsigned *)ptr;
+		case 'l': return (double)*(long *)ptr;
+		case 'L': return (double)*(unsigned long *)ptr;
+		case 'q': return (double)*(long long *)ptr;
+		case 'Q': return (double)*(unsigned long long *)ptr;
+	}
+	return 0.0;
+}
+
+inline void MGLUniformBlock_WriteScalar(char * ptr, char kind, double value) {
+	switch (kind) {
+		case 'f': *(float *)ptr = (float)value; break;
+		case 'd': *(double *)ptr = value; break;
+		case 'i': *(int *)ptr = (int)value; break;
+		case 'u': *(unsigned *)ptr = (unsigned)(long long)value; break;
+		case 'b': *(unsigned *)ptr = value != 0.0; break;
+	}
+}
+
+inline char * MGLUniformBlock_ScalarPtr(char * base, const MGLUniformBlockMember & member, int index) {
+	int components = member.columns * member.rows;
+	int element = index / components;
+	int column = index % components / member.rows;
+	int row = index % member.rows;
+	int scalar_size = member.kind == 'd' ? 8 : 4;
+
+	char * ptr = base + member.offset + element * member.array_stride;
+
+	if (member.row_major) {
+		return ptr + row * member.matrix_stride + column * scalar_size;
+	}
+
+	return ptr + column * member.matrix_stride + row * scalar_size;
+}
+
+// Writes numbers and nested sequences of numbers in column major order.
+bool MGLUniformBlock_PackSequence(char * base, const MGLUniformBlockMember & member, PyObject * value, int & index, int total, int depth) {
+	if (PyFloat_Check(value) || PyLong_Check(value)) {
+		if (index >= total) {
+			return false;
+		}
+
+		double number = PyFloat_AsDouble(value);
+		if (PyErr_Occurred()) {
+			return false;
+		}
+
+		MGLUniformBlock_WriteScalar(MGLUniformBlock_ScalarPtr(base, member, index++), member.kind, number);
+		return true;
+	}
+
+	if (depth == 3) {
+		return false;
+	}
+
+	PyObject * seq = PySequence_Fast(value, "not iterable");
+	if (!seq) {
+		PyErr_Clear();
+		return false;
+	}
+
+	Py_ssize_t size = PySequence_Fast_GET_SIZE(seq);
+
+	for (Py_ssize_t i = 0; i < size; ++i) {
+		if (!MGLUniformBlock_PackSequence(base, member, PySequence_Fast_GET_ITEM(seq, i), index, total, depth + 1)) {
+			Py_DECREF(seq);
+			return false;
+		}
+	}
+
+	Py_DECREF(seq);
+	return true;
+}
+
+bool MGLUniformBlock_PackMember(char * base, const MGLUniformBlockMember & member, PyObject * name, PyObject * value) {
+	int components = member.columns * member.rows;
+	int total = components * member.array_length;
+
+	if (!PyFloat_Check(value) && !PyLong_Check(value) && PyObject_CheckBuffer(value)) {
+		Py_buffer buffer_view;
+
+		if (PyObject_GetBuffer(value, &buffer_view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+			MGLError_Set("the value of %R does not support buffer interface", name);
+			return false;
+		}
+
+		const char * format = buffer_view.format ? buffer_view.format : "B";
+		if (format[0] == '<' || format[0] == '=' || format[0] == '@') {
+			format += 1;
+		}
+
+		if (!format[0] || format[1] || !strchr("fdbB?hHiIlLqQ", format[0])) {
+			MGLError_Set("the value of %R has an unsupported format %s", name, buffer_view.format);
+			PyBuffer_Release(&buffer_view);
+			return false;
+		}
+
+		Py_ssize_t count = buffer_view.len / buffer_view.itemsize;
+
+		if (count > total || count % components) {
+			MGLError_Set("the value of %R has %zd items, expected %d", name, count, total);
+			PyBuffer_Release(&buffer_view);
+			return false;
+		}
+
+		const char * src = (const char *)buffer_view.buf;
+		for (int i = 0; i < count; ++i) {
+			double number = MGLUniformBlock_ReadScalar(src + i * buffer_view.itemsize, format[0]);
+			MGLUniformBlock_WriteScalar(MGLUniformBlock_ScalarPtr(base, member, i), member.kind, number);
+		}
+
+		PyBuffer_Release(&buffer_view);
+		return true;
+	}
+
+	int index = 0;
+
+	if (!MGLUniformBlock_PackSequence(base, member, value, index, total, 0) || index % components) {
+		if (!PyErr_Occurred()) {
+			MGLError_Set("invalid value for %R, expected up to %d numbers in multiples of %d", name, total, components);
+		}
+		return false;
+	}
+
+	return true;
+}
+
+PyObject * MGLUniformBlock_pack(MGLUniformBlock * self, PyObject * args) {
+	PyObject * values;
+	PyObject * out;
+	Py_ssize_t offset;
+
+	int args_ok = PyArg_ParseTuple(
+		args,
+		"O!On",
+		&PyDict_Type,
+		&values,
+		&out,
+		&offset
+	);
+
+	if (!args_ok) {
+		return 0;
+	}
+
+	PyObject * result = 0;
+	MGLBuffer * buffer = 0;
+	Py_buffer buffer_view = {};
+	char * base = 0;
+
+	if (out == Py_None) {
+		if (offset) {
+			MGLError_Set("offset requires an output");
+			return 0;
+		}
+
+		result = PyBytes_FromStringAndSize(0, self->size);
+		base = PyBytes_AS_STRING(result);
+		memset(base, 0, self->size);
+
+	} else if (Py_TYPE(out) == &MGLBuffer_Type) {
+		buffer = (MGLBuffer *)out;
+
+		if (offset < 0 || offset + self->size > buffer->size) {
+			MGLError_Set("out of range offset = %zd or size = %d", offset, self->size);
+			return 0;
+		}
+
+		if (buffer->persistent_map) {
+			base = buffer->persistent_map + offset;
+		} else {
+			const GLMethods & gl = buffer->context->gl;
+			gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+			base = (char *)gl.MapBufferRange(GL_ARRAY_BUFFER, offset, self->size, GL_MAP_WRITE_BIT);
+
+			if (!base) {
+				MGLError_Set("cannot map the buffer");
+				return 0;
+			}
+		}
+
+	} else {
+		if (PyObject_GetBuffer(out, &buffer_view, PyBUF_WRITABLE) < 0) {
+			MGLError_Set("the output (%s) is not a writable buffer", Py_TYPE(out)->tp_name);
+			return 0;
+		}
+
+		if (offset < 0 || offset + self->size > buffer_view.len) {
+			MGLError_Set("out of range offset = %zd or size = %d", offset, self->size);
+			PyBuffer_Release(&buffer_view);
+			return 0;
+		}
+
+		base = (char *)buffer_view.buf + offset;
+	}
+
+	bool ok = true;
+
+	PyObject * key;
+	PyObject * value;
+	Py_ssize_t pos = 0;
+
+	while (PyDict_Next(values, &pos, &key, &value)) {
+		PyObject * index = PyDict_GetItem(self->member_lookup, key);
+
+		if (!index) {
+			MGLError_Set("the uniform block has no member %R", key);
+			ok = false;
+			break;
+		}
+
+		if (!MGLUniformBlock_PackMember(base, self->members[PyLong_AsLong(index)], key, value)) {
+			ok = false;
+			break;
+		}
+	}
+
+	if (buffer && !buffer->persistent_map) {
+		const GLMethods & gl = buffer->context->gl;
+		gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
+		gl.UnmapBuffer(GL_ARRAY_BUFFER);
+	}
+
+	if (buffer_view.buf) {
+		PyBuffer_Release(&buffer_view);
+	}
+
+	if (!ok) {
+		Py_XDECREF(result);
+		return 0;
+	}
+
+	if (result) {
+		return result;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject * MGLUniformBlock_get_layout(MGLUniformBlock * self, void * closure) {
+	PyObject * result = PyDict_New();
+
+	PyObject * key;
+	PyObject * value;
+	Py_ssize_t pos = 0;
+
+	while (PyDict_Next(self->member_lookup, &pos, &key, &value)) {
+		const MGLUniformBlockMember & member = self->members[PyLong_AsLong(value)];
+		PyObject * item = Py_BuildValue(
+			"(iiiiiiCO)",
+			member.offset,
+			member.array_length,
+			member.array_stride,
+			member.matrix_stride,
+			member.columns,
+			member.rows,
+			member.kind,
+			member.row_major ? Py_True : Py_False
+		);
+		PyDict_SetItem(result, key, item);
+		Py_DECREF(item);
+	}
+
+	return result;
+}
+
 PyMethodDef MGLUniformBlock_tp_methods[] = {
+	{"pack", (PyCFunction)MGLUniformBlock_pack, METH_VARARGS, 0},
 	{0},
 };
 
@@ -38,6 +318,7 @@ int MGLUniformBlock_set_binding(MGLUniformBlock * self, PyObject * value, void *
 
 PyGetSetDef MGLUniformBlock_tp_getseters[] = {
 	{(char *)"binding", (getter)MGLUniformBlock_get_binding, (setter)MGLUniformBlock_set_binding, 0, 0},
+	{(char *)"layout", (getter)MGLUniformBlock_get_layout, 0, 0, 0},
 	{0},
 };
 
@@ -82,5 +363,121 @@ PyTypeObject MGLUniformBlock_Type = {
 	MGLUniformBlock_tp_new,                                 // tp_new
 };
 
+// Columns and rows of the GLSL type and the kind of its scalars: float, double, int, uint or bool.
+bool MGLUniformBlock_TypeShape(int type, char & kind, int & columns, int & rows) {
+	columns = 1;
+
+	switch (type) {
+		case GL_FLOAT: kind = 'f'; rows = 1; return true;
+		case GL_FLOAT_VEC2: kind = 'f'; rows = 2; return true;
+		case GL_FLOAT_VEC3: kind = 'f'; rows = 3; return true;
+		case GL_FLOAT_VEC4: kind = 'f'; rows = 4; return true;
+		case GL_DOUBLE: kind = 'd'; rows = 1; return true;
+		case GL_DOUBLE_VEC2: kind = 'd'; rows = 2; return true;
+		case GL_DOUBLE_VEC3: kind = 'd'; rows = 3; return true;
+		case GL_DOUBLE_VEC4: kind = 'd'; rows = 4; return true;
+		case GL_INT: kind = 'i'; rows = 1; return true;
+		case GL_INT_VEC2: kind = 'i'; rows = 2; return true;
+		case GL_INT_VEC3: kind = 'i'; rows = 3; return true;
+		case GL_INT_VEC4: kind = 'i'; rows = 4; return true;
+		case GL_UNSIGNED_INT: kind = 'u'; rows = 1; return true;
+		case GL_UNSIGNED_INT_VEC2: kind = 'u'; rows = 2; return true;
+		case GL_UNSIGNED_INT_VEC3: kind = 'u'; rows = 3; return true;
+		case GL_UNSIGNED_INT_VEC4: kind = 'u'; rows = 4; return true;
+		case GL_BOOL: kind = 'b'; rows = 1; return true;
+		case GL_BOOL_VEC2: kind = 'b'; rows = 2; return true;
+		case GL_BOOL_VEC3: kind = 'b'; rows = 3; return true;
+		case GL_BOOL_VEC4: kind = 'b'; rows = 4; return true;
+		case GL_FLOAT_MAT2: kind = 'f'; columns = 2; rows = 2; return true;
+		case GL_FLOAT_MAT2x3: kind = 'f'; columns = 2; rows = 3; return true;
+		case GL_FLOAT_MAT2x4: kind = 'f'; columns = 2; rows = 4; return true;
+		case GL_FLOAT_MAT3x2: kind = 'f'; columns = 3; rows = 2; return true;
+		case GL_FLOAT_MAT3: kind = 'f'; columns = 3; rows = 3; return true;
+		case GL_FLOAT_MAT3x4: kind = 'f'; columns = 3; rows = 4; return true;
+		case GL_FLOAT_MAT4x2: kind = 'f'; columns = 4; rows = 2; return true;
+		case GL_FLOAT_MAT4x3: kind = 'f'; columns = 4; rows = 3; return true;
+		case GL_FLOAT_MAT4: kind = 'f'; columns = 4; rows = 4; return true;
+		case GL_DOUBLE_MAT2: kind = 'd'; columns = 2; rows = 2; return true;
+		case GL_DOUBLE_MAT2x3: kind = 'd'; columns = 2; rows = 3; return true;
+		case GL_DOUBLE_MAT2x4: kind = 'd'; columns = 2; rows = 4; return true;
+		case GL_DOUBLE_MAT3x2: kind = 'd'; columns = 3; rows = 2; return true;
+		case GL_DOUBLE_MAT3: kind = 'd'; columns = 3; rows = 3; return true;
+		case GL_DOUBLE_MAT3x4: kind = 'd'; columns = 3; rows = 4; return true;
+		case GL_DOUBLE_MAT4x2: kind = 'd'; columns = 4; rows = 2; return true;
+		case GL_DOUBLE_MAT4x3: kind = 'd'; columns = 4; rows = 3; return true;
+		case GL_DOUBLE_MAT4: kind = 'd'; columns = 4; rows = 4; return true;
+	}
+
+	return false;
+}
+
 void MGLUniformBlock_Complete(MGLUniformBlock * uniform_block, const GLMethods & gl) {
+	int program_obj = uniform_block->program_obj;
+	int num_members = 0;
+
+	gl.GetActiveUniformBlockiv(program_obj, uniform_block->index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &num_members);
+
+	int block_name_len = 0;
+	char block_name[256];
+	gl.GetActiveUniformBlockName(program_obj, uniform_block->index, 256, &block_name_len, block_name);
+	clean_glsl_name(block_name, block_name_len);
+
+	unsigned * indices = new unsigned[num_members + 1];
+	int * types = new int[num_members + 1];
+	int * sizes = new int[num_members + 1];
+	int * offsets = new int[num_members + 1];
+	int * array_strides = new int[num_members + 1];
+	int * matrix_strides = new int[num_members + 1];
+	int * row_majors = new int[num_members + 1];
+
+	gl.GetActiveUniformBlockiv(program_obj, uniform_block->index, GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, (int *)indices);
+	gl.GetActiveUniformsiv(program_obj, num_members, indices, GL_UNIFORM_TYPE, types);
+	gl.GetActiveUniformsiv(program_obj, num_members, indices, GL_UNIFORM_SIZE, sizes);
+	gl.GetActiveUniformsiv(program_obj, num_members, indices, GL_UNIFORM_OFFSET, offsets);
+	gl.GetActiveUniformsiv(program_obj, num_members, indices, GL_UNIFORM_ARRAY_STRIDE, array_strides);
+	gl.GetActiveUniformsiv(program_obj, num_members, indices, GL_UNIFORM_MATRIX_STRIDE, matrix_strides);
+	gl.GetActiveUniformsiv(program_obj, num_members, indices, GL_UNIFORM_IS_ROW_MAJOR, row_majors);
+
+	uniform_block->members = new MGLUniformBlockMember[num_members + 1];
+	uniform_block->member_lookup = PyDict_New();
+	uniform_block->num_members = 0;
+
+	for (int i = 0; i < num_members; ++i) {
+		MGLUniformBlockMember & member = uniform_block->members[uniform_block->num_members];
+
+		if (!MGLUniformBlock_TypeShape(types[i], member.kind, member.columns, member.rows)) {
+			continue;
+		}
+
+		member.offset = offsets[i];
+		member.array_length = sizes[i];
+		member.array_stride = array_strides[i];
+		member.matrix_stride = matrix_strides[i];
+		member.row_major = row_majors[i] != 0;
+
+		int name_len = 0;
+		char name[256];
+		gl.GetActiveUniformName(program_obj, indices[i], 256, &name_len, name);
+		clean_glsl_name(name, name_len);
+
+		// Members of a block with an instance name are reported as BlockName.member
+		const char * member_name = name;
+		if (!strncmp(name, block_name, block_name_len) && name[block_name_len] == '.') {
+			member_name += block_name_len + 1;
+		}
+
+		PyObject * index = PyLong_FromLong(uniform_block->num_members);
+		PyDict_SetItemString(uniform_block->member_lookup, member_name, index);
+		Py_DECREF(index);
+
+		uniform_block->num_members += 1;
+	}
+
+	delete[] indices;
+	delete[] types;
+	delete[] sizes;
+	delete[] offsets;
+	delete[] array_strides;
+	delete[] matrix_strides;
+	delete[] row_majors;
 }
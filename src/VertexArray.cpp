@@ -2,19 +2,28 @@
 
 #include "BufferFormat.hpp"
 
+#include <climits>
+
+// Draw calls take GLsizei counts, larger buffers are drawn up to the first 2^31 - 1 items.
+inline int ClampCount(Py_ssize_t count) {
+	return count < INT_MAX ? (int)count : INT_MAX;
+}
+
 PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 	MGLProgram * program;
 	PyObject * content;
+	PyObject * ranges;
 	MGLBuffer * index_buffer;
 	int index_element_size;
 	int skip_errors;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"O!OOIp",
+		"O!OOOIp",
 		&MGLProgram_Type,
 		&program,
 		&content,
+		&ranges,
 		&index_buffer,
 		&index_element_size,
 		&skip_errors
@@ -61,6 +70,15 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 			return 0;
 		}
 
+		PyObject * range = PyTuple_GET_ITEM(ranges, i);
+		Py_ssize_t range_offset = PyLong_AsSsize_t(PyTuple_GET_ITEM(range, 0));
+		Py_ssize_t range_size = PyLong_AsSsize_t(PyTuple_GET_ITEM(range, 1));
+
+		if (range_offset < 0 || range_offset + range_size > ((MGLBuffer *)buffer)->size) {
+			MGLError_Set("content[%d][0] is out of range offset = %zd or size = %zd", i, range_offset, range_size);
+			return 0;
+		}
+
 		FormatIterator it = FormatIterator(PyUnicode_AsUTF8(format));
 		FormatInfo format_info = it.info();
 
@@ -105,6 +123,12 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 					MGLError_Set("invalid format");
 					return 0;
 				}
+
+				// Packed and signed normalized formats can only feed float attributes.
+				if (node->normalize && node->type != GL_UNSIGNED_BYTE && (!attribute->normalizable || attribute->rows_length != 1)) {
+					MGLError_Set("content[%d][1] has a normalized format for a non float attribute content[%d][%d]", i, i, j + 2);
+					return 0;
+				}
 			}
 		}
 	}
@@ -145,7 +169,7 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 	array->index_element_type = element_types[index_element_size];
 
 	if (index_buffer != (MGLBuffer *)Py_None) {
-		array->num_vertices = (int)(index_buffer->size / index_element_size);
+		array->num_vertices = ClampCount(index_buffer->size / index_element_size);
 		gl.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer->buffer_obj);
 	} else {
 		array->num_vertices = -1;
@@ -160,7 +184,16 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 		FormatIterator it = FormatIterator(format);
 		FormatInfo format_info = it.info();
 
-		int buf_vertices = (int)(buffer->size / format_info.size);
+		// Ranges of a buffer arena start at their offset, whole buffers have a negative size.
+		PyObject * range = PyTuple_GET_ITEM(ranges, i);
+		Py_ssize_t range_offset = PyLong_AsSsize_t(PyTuple_GET_ITEM(range, 0));
+		Py_ssize_t range_size = PyLong_AsSsize_t(PyTuple_GET_ITEM(range, 1));
+
+		if (range_size < 0) {
+			range_size = buffer->size - range_offset;
+		}
+
+		int buf_vertices = ClampCount(range_size / format_info.size);
 
 		if (!format_info.divisor && array->index_buffer == (MGLBuffer *)Py_None && (!i || array->num_vertices > buf_vertices)) {
 			array->num_vertices = buf_vertices;
@@ -168,7 +201,7 @@ PyObject * MGLContext_vertex_array(MGLContext * self, PyObject * args) {
 
 		gl.BindBuffer(GL_ARRAY_BUFFER, buffer->buffer_obj);
 
-		char * ptr = 0;
+		char * ptr = (char *)range_offset;
 
 		int attributes_len = (int)PyTuple_GET_SIZE(tuple) - 2;
 
@@ -234,25 +267,82 @@ void MGLVertexArray_tp_dealloc(MGLVertexArray * self) {
 
 inline void MGLVertexArray_SET_SUBROUTINES(MGLVertexArray * self, const GLMethods & gl);
 
+// ranges is None or a tuple of (binding, buffer, offset, size) tuples
+bool MGLVertexArray_BindUniformRanges(MGLContext * context, PyObject * ranges) {
+	if (ranges == Py_None) {
+		return true;
+	}
+
+	const GLMethods & gl = context->gl;
+
+	Py_ssize_t num_ranges = PyTuple_GET_SIZE(ranges);
+
+	for (Py_ssize_t i = 0; i < num_ranges; ++i) {
+		int binding;
+		MGLBuffer * buffer;
+		Py_ssize_t offset;
+		Py_ssize_t size;
+
+		int args_ok = PyArg_ParseTuple(
+			PyTuple_GET_ITEM(ranges, i),
+			"IO!nn",
+			&binding,
+			&MGLBuffer_Type,
+			&buffer,
+			&offset,
+			&size
+		);
+
+		if (!args_ok) {
+			return false;
+		}
+
+		if (size < 0) {
+			size = buffer->size - offset;
+		}
+
+		if (offset < 0 || size < 1 || offset + size > buffer->size) {
+			MGLError_Set("uniform block %d is out of range offset = %zd or size = %zd", binding, offset, size);
+			return false;
+		}
+
+		if (offset % context->uniform_buffer_offset_alignment) {
+			MGLError_Set("uniform block %d offset = %zd is not a multiple of %d", binding, offset, context->uniform_buffer_offset_alignment);
+			return false;
+		}
+
+		gl.BindBufferRange(GL_UNIFORM_BUFFER, binding, buffer->buffer_obj, offset, size);
+	}
+
+	return true;
+}
+
 PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 	int mode;
 	int vertices;
 	int first;
 	int instances;
+	PyObject * uniform_ranges;
 
 	int args_ok = PyArg_ParseTuple(
 		args,
-		"IIII",
+		"IIIIO",
 		&mode,
 		&vertices,
 		&first,
-		&instances
+		&instances,
+		&uniform_ranges
 	);
 
 	if (!args_ok) {
 		return 0;
 	}
 
+	if (uniform_ranges != Py_None && !PyTuple_Check(uniform_ranges)) {
+		MGLError_Set("invalid uniform block ranges");
+		return 0;
+	}
+
 	if (vertices < 0) {
 		if (self->num_vertices < 0) {
 			MGLError_Set("cannot detect the number of vertices");
@@ -262,6 +352,10 @@ PyObject * MGLVertexArray_render(MGLVertexArray * self, PyObject * args) {
 		vertices = self->num_vertices;
 	}
 
+	if (!MGLVertexArray_BindUniformRanges(self->context, uniform_ranges)) {
+		return 0;
+	}
+
 	const GLMethods & gl = self->context->gl;
 
 	gl.UseProgram(self->program->program_obj);
@@ -300,7 +394,7 @@ PyObject * MGLVertexArray_render_indirect(MGLVertexArray * self, PyObject * args
 	}
 
 	if (count < 0) {
-		count = buffer->size / 20 - first;
+		count = ClampCount(buffer->size / 20 - first);
 	}
 
 	const GLMethods & gl = self->context->gl;
@@ -443,7 +537,7 @@ PyObject * MGLVertexArray_bind(MGLVertexArray * self, PyObject * args) {
 
 	switch (type[0]) {
 		case 'f':
-			gl.VertexAttribPointer(location, node->count, node->type, normalize, stride, ptr);
+			gl.VertexAttribPointer(location, node->count, node->type, normalize || node->normalize, stride, ptr);
 			break;
 		case 'i':
 			gl.VertexAttribIPointer(location, node->count, node->type, stride, ptr);
@@ -486,7 +580,7 @@ int MGLVertexArray_set_index_buffer(MGLVertexArray * self, PyObject * value, voi
 	Py_INCREF(value);
 	Py_DECREF(self->index_buffer);
 	self->index_buffer = (MGLBuffer *)value;
-	self->num_vertices = (int)(self->index_buffer->size / 4);
+	self->num_vertices = ClampCount(self->index_buffer->size / self->index_element_size);
 
 	return 0;
 }
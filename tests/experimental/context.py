@@ -13,6 +13,6 @@ def ctx():
             glprocs[lookup['glBufferStorage']] = null
             glprocs[lookup['glClearBufferData']] = null
 
-    context = mgl.create_context(standalone=True, glhook=glhook)
+    context = mgl.create_context(standalone=True, glhook=glhook, backend=os.getenv('MODERNGL_BACKEND'))
 
     return context
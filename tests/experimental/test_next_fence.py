@@ -0,0 +1,43 @@
+import moderngl.next as mgl
+import pytest
+
+
+def test_fence(ctx: mgl.Context):
+    fence = ctx.fence()
+    assert fence.wait()
+    assert fence.signaled
+    fence.release()
+
+
+def test_recorded_fence(ctx: mgl.Context):
+    with ctx.recorder:
+        fence = ctx.fence()
+
+    bytecode = ctx.recorder.dump()
+    assert not fence.signaled
+
+    ctx.replay(bytecode)
+    assert fence.wait()
+    mgl.release(fence)
+
+
+def test_release_recorded_fence(ctx: mgl.Context):
+    with ctx.recorder:
+        fence = ctx.fence()
+
+    bytecode = ctx.recorder.dump()
+    fence.release()
+    ctx.replay(bytecode)
+
+    # The new fence reuses the slot, the old bytecode must not signal it.
+    with ctx.recorder:
+        fence = ctx.fence()
+
+    ctx.recorder.dump()
+    ctx.replay(bytecode)
+    assert not fence.signaled
+    fence.release()
+
+
+if __name__ == '__main__':
+    pytest.main([__file__])
@@ -0,0 +1,132 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_map_array_interface(self):
+        data = np.arange(24, dtype='f4')
+        buf = self.ctx.buffer(data)
+
+        with buf.map_array('f4', (6, 4), access='r') as view:
+            self.assertEqual(view.shape, (6, 4))
+            self.assertEqual(view.dtype, 'f4')
+            array = np.asarray(view)
+            self.assertEqual(array.shape, (6, 4))
+            self.assertEqual(array.dtype, np.float32)
+            self.assertFalse(array.flags.writeable)
+            np.testing.assert_array_equal(array, data.reshape(6, 4))
+            del array
+
+        buf.release()
+
+    def test_map_array_release(self):
+        buf = self.ctx.buffer(np.arange(8, dtype='f4'))
+
+        view = buf.map_array('f4', access='r')
+        array = np.asarray(view)
+
+        # The range stays mapped while the array is alive.
+        with self.assertRaises(BufferError):
+            view.release()
+
+        np.testing.assert_array_equal(array, np.arange(8))
+        del array
+
+        view.release()
+        buf.release()
+
+    def test_map_array_write(self):
+        buf = self.ctx.buffer(reserve=64)
+
+        with buf.map_array('u2', offset=32, access='w') as view:
+            self.assertEqual(view.shape, (16,))
+            np.asarray(view)[:] = np.arange(16)
+
+        np.testing.assert_array_equal(np.frombuffer(buf.read(32, offset=32), 'u2'), np.arange(16))
+        buf.release()
+
+    def test_map_array_dlpack(self):
+        data = np.arange(16, dtype='i4')
+        buf = self.ctx.buffer(data)
+
+        view = buf.map_array('i4', (4, 4))
+        self.assertEqual(view.__dlpack_device__(), (1, 0))
+        array = np.from_dlpack(view)
+        self.assertEqual(array.dtype, np.int32)
+        np.testing.assert_array_equal(array, data.reshape(4, 4))
+
+        # The range stays mapped while the tensor is alive.
+        with self.assertRaises(BufferError):
+            view.release()
+
+        array[0, 0] = 100
+        del array
+
+        # Consumers without DLPack 1.0 get the unversioned capsule.
+        capsule = view.__dlpack__()
+        self.assertIn('dltensor', repr(capsule))
+        del capsule
+        view.release()
+
+        self.assertEqual(np.frombuffer(buf.read(4), 'i4')[0], 100)
+        buf.release()
+
+    def test_map_array_errors(self):
+        buf = self.ctx.buffer(reserve=64)
+
+        with self.assertRaises(moderngl.Error):
+            buf.map_array('f8')
+
+        with self.assertRaises(moderngl.Error):
+            buf.map_array('f4', (5, 4))
+
+        buf.release()
+
+    def test_readback(self):
+        fbo = self.ctx.simple_framebuffer((5, 3), components=4)
+        fbo.use()
+        fbo.clear(0.0, 1.0, 0.0, 1.0)
+
+        readback = fbo.read_async(components=3, alignment=4)
+        self.assertEqual(readback.shape, (3, 5, 3))
+        self.assertEqual(readback.strides, (16, 3, 1))
+
+        pixels = np.asarray(readback)
+        self.assertEqual(pixels.shape, (3, 5, 3))
+        self.assertEqual(pixels.dtype, np.uint8)
+        np.testing.assert_array_equal(pixels, np.broadcast_to([0, 255, 0], (3, 5, 3)))
+
+        tensor = np.from_dlpack(readback)
+        np.testing.assert_array_equal(tensor, pixels)
+        self.assertFalse(tensor.flags.writeable)
+
+        # The bytes of the result are read only.
+        with self.assertRaises(BufferError):
+            readback.__dlpack__()
+        fbo.release()
+
+    def test_readback_float(self):
+        fbo = self.ctx.framebuffer(self.ctx.renderbuffer((4, 4), 4, dtype='f4'))
+        fbo.use()
+        fbo.clear(0.25, 0.5, 0.75, 1.0)
+
+        readback = fbo.read_async(components=4, dtype='f4')
+        self.assertIsNone(readback.strides)
+
+        pixels = np.from_dlpack(readback)
+        self.assertEqual(pixels.dtype, np.float32)
+        np.testing.assert_array_equal(pixels, np.broadcast_to([0.25, 0.5, 0.75, 1.0], (4, 4, 4)))
+        fbo.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
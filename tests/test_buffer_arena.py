@@ -0,0 +1,101 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.arena = self.ctx.buffer_arena(256)
+
+    def tearDown(self):
+        self.arena.release()
+
+    def test_allocate(self):
+        block1 = self.arena.allocate(10)
+        block2 = self.arena.allocate(8, alignment=4)
+        block3 = self.arena.allocate(4)
+        self.assertEqual(block1.offset, 0)
+        self.assertEqual(block2.offset, 12)
+        self.assertEqual(block3.offset, 32)
+        self.assertEqual(self.arena.used, 22)
+        self.assertEqual(self.arena.available, 256 - 22)
+
+        block1.write(b'abcdefghij')
+        block2.write(b'xy', offset=6)
+        self.assertEqual(block1.read(), b'abcdefghij')
+        self.assertEqual(block2.read(2, offset=6), b'xy')
+        self.assertIs(block1.buffer, self.arena.buffer)
+
+        with self.assertRaises(moderngl.Error):
+            block3.write(b'12345')
+
+        with self.assertRaises(moderngl.Error):
+            self.arena.allocate(512)
+
+    def test_free(self):
+        block1 = self.arena.allocate(64)
+        block2 = self.arena.allocate(64)
+        block3 = self.arena.allocate(128)
+        self.assertEqual(self.arena.available, 0)
+
+        block1.free()
+        block2.free()
+        self.assertEqual(self.arena._free, [(0, 128)])
+        self.assertEqual(self.arena.allocate(128).offset, 0)
+
+        with self.assertRaises(moderngl.Error):
+            self.arena.free(block1)
+
+        block3.free()
+
+    def test_compact(self):
+        block1 = self.arena.allocate(64)
+        block2 = self.arena.allocate(80)
+        block2.write(bytes(range(80)))
+        block1.free()
+
+        self.arena.compact()
+        self.assertEqual(block2.offset, 0)
+        self.assertEqual(block2.read(), bytes(range(80)))
+        self.assertEqual(self.arena.available, 256 - 80)
+        self.assertEqual(self.arena.allocate(16).offset, 80)
+
+    def test_vertex_array(self):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec2 in_vert;
+                out vec2 out_vert;
+
+                void main() {
+                    out_vert = in_vert * 2.0;
+                }
+            ''',
+            varyings=['out_vert']
+        )
+
+        self.arena.allocate(20)
+        block = self.arena.allocate(24)
+        block.write(struct.pack('6f', 1.0, 2.0, 3.0, 4.0, 5.0, 6.0))
+
+        vao = self.ctx.simple_vertex_array(prog, block, 'in_vert')
+        self.assertEqual(vao.vertices, 3)
+
+        res = self.ctx.buffer(reserve=24)
+        vao.transform(res, moderngl.POINTS)
+        self.assertEqual(struct.unpack('6f', res.read()), (2.0, 4.0, 6.0, 8.0, 10.0, 12.0))
+        vao.release()
+        res.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
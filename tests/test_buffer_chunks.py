@@ -0,0 +1,77 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_chunk_sizes(self):
+        for chunk_size in [1, 4, 7, 8, 12, 16, 32, 64, 100]:
+            step = chunk_size + 4
+            count = 1000
+            data = np.random.randint(0, 256, chunk_size * count, dtype='u1').tobytes()
+
+            buf = self.ctx.buffer(b'\xff' * (step * count + 16))
+            buf.write_chunks(data, 16, step, count)
+
+            content = np.frombuffer(buf.read(), 'u1')
+            expected = np.full(step * count + 16, 255, 'u1')
+            expected[16:].reshape(count, step)[:, :chunk_size] = np.frombuffer(data, 'u1').reshape(count, chunk_size)
+            np.testing.assert_array_equal(content, expected)
+
+            self.assertEqual(buf.read_chunks(chunk_size, 16, step, count), data)
+            buf.release()
+
+    def test_negative_step(self):
+        buf = self.ctx.buffer(bytes(range(64)))
+        self.assertEqual(buf.read_chunks(16, -16, -16, 4), bytes(range(48, 64)) + bytes(range(32, 48)) + bytes(range(16, 32)) + bytes(range(16)))
+
+        buf.write_chunks(b'a' * 12 + b'b' * 12, 48, -32, 2)
+        self.assertEqual(buf.read_chunks(12, 16, 32, 2), b'b' * 12 + b'a' * 12)
+
+    def test_read_chunks_into(self):
+        buf = self.ctx.buffer(bytes(range(32)))
+        data = bytearray(12)
+        buf.read_chunks_into(data, 4, 0, 8, 2, write_offset=4)
+        self.assertEqual(bytes(data), b'\x00' * 4 + bytes(range(4)) + bytes(range(8, 12)))
+
+    def test_large(self):
+        # Large enough to be split between the copy workers.
+        count = 1 << 20
+        data = np.arange(count * 3, dtype='f4')
+        buf = self.ctx.buffer(reserve=count * 16)
+        buf.write_chunks(data, 0, 16, count)
+
+        res = np.frombuffer(buf.read_chunks(12, 0, 16, count), 'f4')
+        np.testing.assert_array_equal(res, data)
+
+        res = bytearray(count * 12)
+        buf.read_chunks_into(res, 12, 0, 16, count)
+        np.testing.assert_array_equal(np.frombuffer(res, 'f4'), data)
+        buf.release()
+
+    def test_errors(self):
+        buf = self.ctx.buffer(reserve=64)
+
+        with self.assertRaises(moderngl.Error):
+            buf.write_chunks(b'abcd', 0, 4, 0)
+
+        with self.assertRaises(moderngl.Error):
+            buf.read_chunks_into(bytearray(7), 4, 0, 4, 2)
+
+        with self.assertRaises(moderngl.Error):
+            buf.read_chunks_into(bytearray(8), 4, 0, 4, 2, write_offset=4)
+
+        with self.assertRaises(moderngl.Error):
+            buf.read_chunks_into(bytearray(8), 4, 60, 4, 2)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -12,6 +12,8 @@ GL_UNSIGNED_INT = 0x1405
 GL_FLOAT = 0x1406
 GL_DOUBLE = 0x140A
 GL_HALF_FLOAT = 0x140B
+GL_UNSIGNED_INT_2_10_10_10_REV = 0x8368
+GL_INT_2_10_10_10_REV = 0x8D9F
 
 
 class TestBuffer(unittest.TestCase):
@@ -104,6 +106,29 @@ class TestBuffer(unittest.TestCase):
         self.check('2f 2x4/i', (16, 1, 1, True, ((8, 2, GL_FLOAT, False), (8, 2, 0, False))))
         self.check('2f 2x4 /i', (16, 1, 1, True, ((8, 2, GL_FLOAT, False), (8, 2, 0, False))))
 
+    def test_format_8(self):
+        self.check('3n1', (3, 1, 0, True, ((3, 3, GL_BYTE, True),)))
+        self.check('3n2', (6, 1, 0, True, ((6, 3, GL_SHORT, True),)))
+        self.check('4n10', (4, 1, 0, True, ((4, 4, GL_INT_2_10_10_10_REV, True),)))
+        self.check('4f10', (4, 1, 0, True, ((4, 4, GL_UNSIGNED_INT_2_10_10_10_REV, True),)))
+        self.check(
+            '3f2 x2 4n10 2n2/i',
+            (16, 3, 1, True, (
+                (6, 3, GL_HALF_FLOAT, False),
+                (2, 1, 0, False),
+                (4, 4, GL_INT_2_10_10_10_REV, True),
+                (4, 2, GL_SHORT, True),
+            ))
+        )
+
+    def test_format_9(self):
+        self.check('n', (0, 0, 0, False, ()))
+        self.check('2n4', (0, 0, 0, False, ()))
+        self.check('3n10', (0, 0, 0, False, ()))
+        self.check('n10', (0, 0, 0, False, ()))
+        self.check('4u10', (0, 0, 0, False, ()))
+        self.check('4f100', (0, 0, 0, False, ()))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -0,0 +1,68 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        self.pos = np.arange(3000, dtype='f4').reshape(1000, 3)
+        self.uv = np.arange(2000, dtype='f4').reshape(1000, 2) + 0.5
+        self.color = np.arange(4000, dtype='u1').reshape(1000, 4)
+
+    def expected(self):
+        return np.hstack([self.pos, self.uv, self.color.view('f4')]).tobytes()
+
+    def test_pack(self):
+        self.assertEqual(moderngl.pack('3f 2f 4f1', self.pos, self.uv, self.color), self.expected())
+
+    def test_pack_padding(self):
+        data = moderngl.pack('1f 2x 1u2', np.array([1.0, 2.0], 'f4'), np.array([3, 4], 'u2'))
+        self.assertEqual(data, struct.pack('f2xHf2xH', 1.0, 3, 2.0, 4))
+
+    def test_pack_strided(self):
+        vertices = np.zeros(1000, dtype=[('uv', 'f4', 2), ('pos', 'f4', 3)])
+        vertices['pos'] = self.pos
+        vertices['uv'] = self.uv
+        data = moderngl.pack('3f 2f 4f1', vertices['pos'], vertices['uv'], self.color)
+        self.assertEqual(data, self.expected())
+
+    def test_write_interleaved(self):
+        buf = self.ctx.buffer(reserve=1000 * 24 + 16)
+        buf.write_interleaved('3f 2f 4f1', [self.pos, self.uv, self.color], offset=16)
+        self.assertEqual(buf.read(offset=16), self.expected())
+
+    def test_write_interleaved_padding(self):
+        buf = self.ctx.buffer(moderngl.pack('3f 2f 4f1', self.pos, self.uv, self.color))
+        buf.write_interleaved('12x 2f 4x', [self.uv * 2.0])
+        self.uv *= 2.0
+        self.assertEqual(buf.read(), self.expected())
+
+    def test_errors(self):
+        with self.assertRaises(moderngl.Error):
+            moderngl.pack('3f 2f', self.pos)
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.pack('3f 2f', self.pos, self.uv[:500])
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.pack('3f', self.pos[:, ::2])
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.pack('3z', self.pos)
+
+        buf = self.ctx.buffer(reserve=16)
+        with self.assertRaises(moderngl.Error):
+            buf.write_interleaved('3f', [self.pos])
+
+
+if __name__ == '__main__':
+    unittest.main()
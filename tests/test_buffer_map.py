@@ -0,0 +1,70 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_map_read(self):
+        buf = self.ctx.buffer(b'abcdefgh')
+        with buf.map(4, offset=2, access='r') as mem:
+            self.assertTrue(mem.readonly)
+            self.assertEqual(len(mem), 4)
+            self.assertEqual(bytes(mem), b'cdef')
+        buf.release()
+
+    def test_map_write(self):
+        buf = self.ctx.buffer(b'abcdefgh')
+        with buf.map(3, offset=4, access='w', invalidate=True) as mem:
+            mem[:] = b'xyz'
+        self.assertEqual(buf.read(), b'abcdxyzh')
+        buf.release()
+
+    def test_map_rebind(self):
+        buf1 = self.ctx.buffer(b'abcd')
+        buf2 = self.ctx.buffer(b'efgh')
+        with buf1.map() as mem:
+            buf2.write(b'ijkl')
+            mem[:2] = b'xy'
+        self.assertEqual(buf1.read(), b'xycd')
+        self.assertEqual(buf2.read(), b'ijkl')
+        buf1.release()
+        buf2.release()
+
+    def test_map_numpy(self):
+        try:
+            import numpy as np
+        except ImportError:
+            self.skipTest('numpy is not installed')
+
+        buf = self.ctx.buffer(struct.pack('4f', 1.0, 2.0, 3.0, 4.0))
+        with buf.map(access='r') as mem:
+            array = np.frombuffer(mem, dtype='f4')
+            self.assertEqual(array.sum(), 10.0)
+            del array
+        buf.release()
+
+    def test_map_errors(self):
+        buf = self.ctx.buffer(reserve=8)
+
+        with self.assertRaises(moderngl.Error):
+            buf.map(4, offset=6)
+
+        with self.assertRaises(moderngl.Error):
+            buf.map(access='x')
+
+        with self.assertRaises(moderngl.Error):
+            buf.map(access='rw', invalidate=True)
+
+        buf.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
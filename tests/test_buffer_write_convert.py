@@ -0,0 +1,113 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def convert(self, data, src_dtype, dst_format, dst_dtype):
+        buf = self.ctx.buffer(reserve=data.size * np.dtype(dst_dtype).itemsize)
+        buf.write(data, src_dtype=src_dtype, dst_format=dst_format)
+        res = np.frombuffer(buf.read(), dtype=dst_dtype)
+        buf.release()
+        return res
+
+    def test_f8_to_f4(self):
+        data = np.random.uniform(-1e6, 1e6, 3000)
+        np.testing.assert_array_equal(self.convert(data, 'f8', '3f4', 'f4'), data.astype('f4'))
+
+    def test_f4_to_f2_round_trip(self):
+        values = np.array([0.0, -0.0, 1.0, -2.5, 65504.0, 65519.0, 65520.0, 1e6, -1e6, 6e-8, 3e-5, 1e-10,
+                           np.inf, -np.inf], dtype='f4')
+        data = np.concatenate([values, np.random.uniform(-1000.0, 1000.0, 1001).astype('f4')])
+        half = self.convert(data, 'f4', 'f2', 'f2')
+        np.testing.assert_array_equal(half, data.astype('f2'))
+        np.testing.assert_array_equal(self.convert(half, 'f2', 'f4', 'f4'), half.astype('f4'))
+
+        nan = self.convert(np.array([np.nan] * 9, dtype='f4'), 'f4', 'f2', 'f2')
+        self.assertTrue(np.isnan(nan).all())
+
+    def test_integer_narrowing(self):
+        data = np.array([-100000, -32769, -32768, -1, 0, 1, 255, 256, 32767, 32768, 100000] * 3, dtype='i4')
+        np.testing.assert_array_equal(self.convert(data, 'i4', 'i2', 'i2'), np.clip(data, -32768, 32767))
+        np.testing.assert_array_equal(self.convert(data, 'i4', 'u1', 'u1'), np.clip(data, 0, 255))
+
+        data = np.clip(data, -32768, 32767).astype('i2')
+        np.testing.assert_array_equal(self.convert(data, 'i2', 'u1', 'u1'), np.clip(data, 0, 255))
+
+    def test_float_to_normalized(self):
+        data = np.array([-1.0, 0.0, 0.5, 1.0, 2.0, np.nan], dtype='f4')
+        np.testing.assert_array_equal(self.convert(data, 'f4', 'f1', 'u1'), [0, 0, 128, 255, 255, 0])
+
+    def test_mixed_format(self):
+        data = np.arange(12, dtype='f8')
+        buf = self.ctx.buffer(b'\xff' * 40)
+        buf.write(data, src_dtype='f8', dst_format='3f4 2x 3i2')
+        res = np.frombuffer(buf.read(), dtype=[('pos', 'f4', 3), ('pad', 'u1', 2), ('ids', 'i2', 3)])
+        np.testing.assert_array_equal(res['pos'], [[0, 1, 2], [6, 7, 8]])
+        np.testing.assert_array_equal(res['pad'], [[255, 255], [255, 255]])
+        np.testing.assert_array_equal(res['ids'], [[3, 4, 5], [9, 10, 11]])
+
+    def test_texture(self):
+        data = np.linspace(0.0, 1.0, 16 * 4, dtype='f8')
+        texture = self.ctx.texture((4, 4), 4, dtype='f4')
+        texture.write(data, src_dtype='f8')
+        np.testing.assert_array_equal(np.frombuffer(texture.read(), dtype='f4'), data.astype('f4'))
+        texture.release()
+
+        texture = self.ctx.texture((4, 4), 4)
+        texture.write(data, src_dtype='f8')
+        np.testing.assert_array_equal(np.frombuffer(texture.read(), dtype='u1'), np.floor(data * 255.0 + 0.5))
+        texture.release()
+
+    def test_texture_viewport(self):
+        # Rows of 3 one byte pixels are padded with an alignment of 4, the converted pixels are not.
+        texture = self.ctx.texture((3, 2), 1)
+        data = np.array([0.0, 0.5, 1.0, 1.0, 0.5, 0.0], dtype='f8')
+        texture.write(data, alignment=4, src_dtype='f8')
+        self.assertEqual(texture.read(alignment=1), bytes([0, 128, 255, 255, 128, 0]))
+
+        texture.write(np.ones(2, dtype='f8'), (1, 1, 2, 1), alignment=4, src_dtype='f8')
+        self.assertEqual(texture.read(alignment=1), bytes([0, 128, 255, 255, 255, 255]))
+        texture.release()
+
+    def test_texture_errors(self):
+        texture = self.ctx.texture((4, 4), 4, dtype='bc1')
+        with self.assertRaises(moderngl.Error):
+            texture.write(np.zeros(64), src_dtype='f8')
+        texture.release()
+
+        texture = self.ctx.texture((4, 4), 4, dtype='f4')
+        buf = self.ctx.buffer(reserve=512)
+        with self.assertRaises(moderngl.Error):
+            texture.write(buf, src_dtype='f8')
+        buf.release()
+        texture.release()
+
+    def test_errors(self):
+        buf = self.ctx.buffer(reserve=64)
+
+        with self.assertRaises(moderngl.Error):
+            buf.write(np.zeros(4), src_dtype='f8')
+
+        with self.assertRaises(moderngl.Error):
+            buf.write(np.zeros(4), src_dtype='f3', dst_format='f4')
+
+        with self.assertRaises(moderngl.Error):
+            buf.write(np.zeros(4), src_dtype='f8', dst_format='3f4')
+
+        with self.assertRaises(moderngl.Error):
+            buf.write(np.zeros(32), src_dtype='f8', dst_format='f4')
+
+        buf.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,55 @@
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_write_many(self):
+        buf = self.ctx.buffer(b'.' * 16)
+        buf.write_many([(12, b'xy'), (1, b'abc'), (8, bytearray(b'z')), (5, b'')])
+        self.assertEqual(buf.read(), b'.abc....z...xy..')
+        buf.write_many([])
+        buf.release()
+
+    def test_write_many_stream_buffer(self):
+        try:
+            stream = self.ctx.stream_buffer(16, regions=1)
+        except moderngl.Error as ex:
+            self.skipTest(str(ex))
+
+        stream.write_many([(0, b'ab'), (14, b'cd')])
+        buf = self.ctx.buffer(reserve=16)
+        self.ctx.copy_buffer(buf, stream)
+        self.assertEqual(buf.read(2), b'ab')
+        self.assertEqual(buf.read(2, offset=14), b'cd')
+        buf.release()
+        stream.release()
+
+    def test_write_many_errors(self):
+        buf = self.ctx.buffer(b'.' * 8)
+
+        with self.assertRaises(moderngl.Error):
+            buf.write_many([(0, b'ab'), (7, b'cd')])
+
+        with self.assertRaises(moderngl.Error):
+            buf.write_many([(-1, b'ab')])
+
+        with self.assertRaises(moderngl.Error):
+            buf.write_many([(0, 'ab')])
+
+        with self.assertRaises(moderngl.Error):
+            buf.write_many([b'ab'])
+
+        self.assertEqual(buf.read(), b'.' * 8)
+        buf.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,47 @@
+import unittest
+
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def check(self, array):
+        buf = self.ctx.buffer(reserve=array.nbytes + 8)
+        buf.write(array, offset=8)
+        np.testing.assert_array_equal(np.frombuffer(buf.read(array.nbytes, offset=8), dtype=array.dtype), array.ravel())
+        buf.release()
+
+    def test_column(self):
+        vertices = np.zeros(1000, dtype=[('pos', 'f4', 3), ('uv', 'f4', 2), ('id', 'u4')])
+        vertices['pos'] = np.arange(3000).reshape(1000, 3)
+        vertices['uv'] = np.arange(2000).reshape(1000, 2)
+        vertices['id'] = np.arange(1000)
+        self.check(vertices['pos'])
+        self.check(vertices['uv'])
+        self.check(vertices['id'])
+
+    def test_item_sizes(self):
+        for dtype in ['u1', 'u2', 'f4', 'f8', 'c16']:
+            array = np.arange(777 * 3).astype(dtype)
+            self.check(array[::3])
+            self.check(array[::-2])
+
+    def test_2d(self):
+        array = np.arange(64 * 64, dtype='f4').reshape(64, 64)
+        self.check(array[::2, ::3])
+        self.check(array.T)
+        self.check(array[:, 5:9])
+
+    def test_3d(self):
+        array = np.arange(8 * 8 * 8, dtype='f4').reshape(8, 8, 8)
+        self.check(array[:, ::2, 1:5])
+
+
+if __name__ == '__main__':
+    unittest.main()
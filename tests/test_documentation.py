@@ -43,6 +43,15 @@ class TestCase(unittest.TestCase):
     def test_buffer_docs(self):
         self.validate('buffer.rst', 'Buffer', ['release', 'mglo', 'glo', 'ctx'])
 
+    def test_mapped_array_docs(self):
+        self.validate('mapped_array.rst', 'MappedArray', [])
+
+    def test_streaming_loader_docs(self):
+        self.validate('streaming_loader.rst', 'StreamingLoader', ['ctx'])
+
+    def test_resource_cache_docs(self):
+        self.validate('resource_cache.rst', 'ResourceCache', ['ctx'])
+
     def test_texture_docs(self):
         self.validate('texture.rst', 'Texture', ['release', 'mglo', 'glo', 'ctx'])
 
@@ -52,18 +61,39 @@ class TestCase(unittest.TestCase):
     def test_texture3d_docs(self):
         self.validate('texture3d.rst', 'Texture3D', ['release', 'mglo', 'glo', 'ctx'])
 
+    def test_texture_stream_docs(self):
+        self.validate('texture_stream.rst', 'TextureStream', ['ctx'])
+
     def test_texture_cube_docs(self):
         self.validate('texture_cube.rst', 'TextureCube', ['release', 'mglo', 'glo', 'ctx'])
 
+    def test_texture_buffer_docs(self):
+        self.validate('texture_buffer.rst', 'TextureBuffer', ['mglo', 'ctx'])
+
     def test_framebuffer_docs(self):
         self.validate('framebuffer.rst', 'Framebuffer', ['release', 'mglo', 'glo', 'ctx'])
 
     def test_renderbuffer_docs(self):
         self.validate('renderbuffer.rst', 'Renderbuffer', ['release', 'mglo', 'glo', 'ctx'])
 
+    def test_buffer_arena_docs(self):
+        self.validate('buffer_arena.rst', 'BufferArena', ['ctx'])
+
+    def test_buffer_allocation_docs(self):
+        self.validate('buffer_arena.rst', 'BufferAllocation', [])
+
+    def test_uniform_ring_docs(self):
+        self.validate('uniform_ring.rst', 'UniformRing', ['ctx'])
+
+    def test_readback_docs(self):
+        self.validate('readback.rst', 'Readback', ['ctx'])
+
     def test_query_docs(self):
         self.validate('query.rst', 'Query', ['mglo', 'ctx'])
 
+    def test_fence_docs(self):
+        self.validate('fence.rst', 'Fence', ['release', 'mglo', 'ctx'])
+
     def test_scope_docs(self):
         self.validate('scope.rst', 'Scope', ['mglo', 'ctx'])
 
@@ -0,0 +1,52 @@
+import platform
+import subprocess
+import sys
+import unittest
+
+import moderngl
+
+# Creating a standalone context makes it current, the test runs in its own process
+# so that releasing it cannot leave the shared test context without a current context.
+STANDALONE_CONTEXT = '''
+import moderngl
+
+for _ in range(2):
+    try:
+        ctx = moderngl.create_standalone_context(backend='egl')
+    except moderngl.Error as ex:
+        print('skip:', ex)
+        raise SystemExit(0)
+
+    rbo = ctx.renderbuffer((4, 4))
+    fbo = ctx.framebuffer(rbo)
+    fbo.use()
+    fbo.clear(1.0, 0.0, 0.0, 1.0)
+
+    assert ctx.version_code >= 310, ctx.version_code
+    assert fbo.read(components=4) == b'\\xff\\x00\\x00\\xff' * 16
+    ctx.release()
+
+print('ok')
+'''
+
+
+@unittest.skipUnless(platform.system() == 'Linux', 'the egl backend is only supported on linux')
+class TestCase(unittest.TestCase):
+
+    def test_egl_standalone_context(self):
+        proc = subprocess.run([sys.executable, '-c', STANDALONE_CONTEXT], stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+        output = proc.stdout.decode()
+
+        if output.startswith('skip:'):
+            self.skipTest(output[5:].strip())
+
+        self.assertEqual(proc.returncode, 0, output)
+        self.assertEqual(output.strip(), 'ok')
+
+    def test_invalid_backend(self):
+        with self.assertRaisesRegex(moderngl.Error, 'invalid backend'):
+            moderngl.create_standalone_context(backend='invalid')
+
+
+if __name__ == '__main__':
+    unittest.main()
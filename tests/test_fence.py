@@ -0,0 +1,34 @@
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_wait(self):
+        buf = self.ctx.buffer(reserve=1024)
+        buf.clear(chunk=b'abcd')
+        fence = self.ctx.fence()
+        self.assertTrue(fence.wait())
+        self.assertTrue(fence.signaled)
+        fence.release()
+
+    def test_poll(self):
+        fence = self.ctx.fence()
+        self.assertIsInstance(fence.wait(0), bool)
+        self.ctx.finish()
+        self.assertTrue(fence.signaled)
+        fence.release()
+
+    def test_release(self):
+        fence = self.ctx.fence()
+        fence.release()
+        self.assertEqual(type(fence.mglo).__name__, 'InvalidObject')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,53 @@
+import unittest
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_read_async(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        fbo.clear(0.0, 1.0, 0.0, 1.0)
+
+        readback = fbo.read_async(components=4)
+        self.assertEqual(readback.size, 64)
+        self.assertEqual(readback.result(), fbo.read(components=4))
+        self.assertTrue(readback.done)
+        self.assertEqual(readback.result(), b'\x00\xff\x00\xff' * 16)
+
+    def test_read_async_viewport(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        fbo.clear(1.0, 0.0, 0.0, 1.0)
+
+        readback = fbo.read_async((1, 1, 3, 2), alignment=4)
+        self.assertEqual(readback.result(), fbo.read((1, 1, 3, 2), alignment=4))
+        self.assertEqual(readback.size, 24)
+
+    def test_reuse_pack_buffers(self):
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        fbo.clear(0.0, 0.0, 1.0, 1.0)
+
+        first = fbo.read_async()
+        first.result()
+        second = fbo.read_async()
+        self.assertEqual(second.result(), b'\x00\x00\xff' * 16)
+        self.assertEqual(len(self.ctx._pack_buffers[48]), 1)
+
+    def test_pack_buffers_bounded(self):
+        for width in range(1, 17):
+            fbo = self.ctx.simple_framebuffer((width, 1))
+            readbacks = [fbo.read_async(components=4) for _ in range(6)]
+            for readback in readbacks:
+                readback.result()
+            fbo.release()
+
+        self.assertLessEqual(len(self.ctx._pack_buffers), 4)
+        self.assertTrue(all(len(pool) <= 4 for pool in self.ctx._pack_buffers.values()))
+
+
+if __name__ == '__main__':
+    unittest.main()
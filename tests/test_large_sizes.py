@@ -0,0 +1,85 @@
+import unittest
+
+import moderngl
+
+from common import get_context
+
+LARGE = 2 ** 31 + 4096
+
+
+def available_memory():
+    try:
+        with open('/proc/meminfo') as f:
+            for line in f:
+                if line.startswith('MemAvailable:'):
+                    return int(line.split()[1]) * 1024
+    except OSError:
+        pass
+    return None
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def require_memory(self, size):
+        memory = available_memory()
+        if memory is None or memory < size:
+            self.skipTest('not enough memory for a %d byte test' % size)
+
+    def test_reserve_negative(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.buffer(reserve=-1)
+
+    def test_buffer_large_offsets(self):
+        self.require_memory(LARGE * 2)
+
+        try:
+            buf = self.ctx.buffer(reserve=LARGE)
+        except moderngl.Error:
+            self.skipTest('cannot allocate a %d byte buffer' % LARGE)
+
+        self.assertEqual(buf.size, LARGE)
+
+        buf.write(b'abcdefgh', offset=2 ** 31 + 8)
+        buf.write(b'ijkl', offset=LARGE - 4)
+        self.assertEqual(buf.read(8, offset=2 ** 31 + 8), b'abcdefgh')
+        self.assertEqual(buf.read(4, offset=LARGE - 4), b'ijkl')
+        self.assertEqual(buf.read_chunks(2, 2 ** 31 + 8, 4, 2), b'abef')
+
+        target = bytearray(8)
+        buf.read_into(target, 8, offset=2 ** 31 + 8)
+        self.assertEqual(bytes(target), b'abcdefgh')
+
+        with self.assertRaises(moderngl.Error):
+            buf.write(b'abcdefgh', offset=LARGE - 4)
+
+        buf.release()
+
+    def test_texture_large_read(self):
+        # 2048 x 1024 x 1025 single channel bytes is just above 2 GB.
+        depth = 1025
+        size = 2048 * 1024 * depth
+        self.require_memory(size * 2)
+
+        if self.ctx.info['GL_MAX_3D_TEXTURE_SIZE'] < depth:
+            self.skipTest('3d textures are limited to %d layers' % self.ctx.info['GL_MAX_3D_TEXTURE_SIZE'])
+
+        self.ctx.error
+        texture = self.ctx.texture3d((2048, 1024, depth), 1)
+        if self.ctx.error != 'GL_NO_ERROR':
+            texture.release()
+            self.skipTest('cannot allocate a %d byte texture' % size)
+
+        texture.write(b'\x7f' * 16, (2032, 1023, depth - 1, 16, 1, 1))
+        data = texture.read()
+
+        self.assertEqual(len(data), size)
+        self.assertEqual(data[-16:], b'\x7f' * 16)
+        texture.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,143 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+def pack_reference(values, signed=True):
+    # One rounding rule for every element: scale in single precision, then round half to even.
+    values = np.asarray(values, dtype='f4').reshape(-1, 4)
+    if signed:
+        scaled = np.rint(np.clip(values, -1.0, 1.0) * np.array([511.0, 511.0, 511.0, 1.0], 'f4')).astype('i8')
+    else:
+        scaled = np.rint(np.clip(values, 0.0, 1.0) * np.array([1023.0, 1023.0, 1023.0, 3.0], 'f4')).astype('i8')
+    scaled &= [0x3ff, 0x3ff, 0x3ff, 0x3]
+    return (scaled[:, 0] | scaled[:, 1] << 10 | scaled[:, 2] << 20 | scaled[:, 3] << 30).astype('u4')
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec4 in_vert;
+                out vec4 out_vert;
+
+                void main() {
+                    out_vert = in_vert;
+                }
+            ''',
+            varyings=['out_vert']
+        )
+
+    def setUp(self):
+        normals = np.random.normal(size=(1001, 3)).astype('f4')
+        self.normals = normals / np.linalg.norm(normals, axis=1)[:, None]
+
+    def transform(self, data, fmt, vertices):
+        vbo = self.ctx.buffer(data)
+        res = self.ctx.buffer(reserve=vertices * 16)
+        vao = self.ctx.vertex_array(self.prog, [(vbo, fmt, 'in_vert')])
+        vao.transform(res, moderngl.POINTS)
+        return np.frombuffer(res.read(), dtype='f4').reshape(vertices, 4)
+
+    def test_encode_normals(self):
+        data = moderngl.encode_normals(self.normals)
+        self.assertEqual(len(data), 1001 * 4)
+        vectors = np.hstack([self.normals, np.zeros((1001, 1), 'f4')])
+        np.testing.assert_array_equal(np.frombuffer(data, 'u4'), pack_reference(vectors))
+
+        vectors = np.hstack([self.normals, np.ones((1001, 1), 'f4')])
+        data = moderngl.encode_normals(vectors, components=4)
+        np.testing.assert_array_equal(np.frombuffer(data, 'u4'), pack_reference(vectors))
+
+    def test_encode_normals_halfway(self):
+        # The product is close to -238.5 in single precision, the vectorized body and the scalar tail must agree.
+        for vertices in [1, 3, 4, 5, 9]:
+            vectors = np.array([[-0.4667319, 0.0, 0.0]] * vertices, 'f4')
+            data = np.frombuffer(moderngl.encode_normals(vectors), 'u4')
+            self.assertEqual(len(set(data.tolist())), 1)
+            np.testing.assert_array_equal(data, pack_reference(np.hstack([vectors, np.zeros((vertices, 1), 'f4')])))
+
+    def test_render_packed_normals(self):
+        data = moderngl.encode_normals(self.normals)
+        res = self.transform(data, '4n10', 1001)
+        np.testing.assert_allclose(res[:, :3], self.normals, atol=1.0 / 511.0)
+        np.testing.assert_array_equal(res[:, 3], 0.0)
+
+    def test_render_packed_unsigned(self):
+        colors = np.random.uniform(0.0, 1.0, (100, 4)).astype('f4')
+        res = self.transform(pack_reference(colors, signed=False), '4f10', 100)
+        scale = np.array([1023, 1023, 1023, 3], 'f4')
+        np.testing.assert_allclose(res, np.rint(colors * scale) / scale, atol=1e-6)
+
+    def test_write_converted(self):
+        vectors = np.hstack([self.normals, np.zeros((1001, 1), 'f4')])
+        buf = self.ctx.buffer(reserve=1001 * 4)
+        buf.write(vectors, src_dtype='f4', dst_format='4n10')
+        np.testing.assert_array_equal(np.frombuffer(buf.read(), 'u4'), pack_reference(vectors))
+
+        buf = self.ctx.buffer(reserve=1001 * 8)
+        buf.write(vectors, src_dtype='f4', dst_format='4n2')
+        np.testing.assert_array_equal(np.frombuffer(buf.read(), 'i2'), np.rint(vectors.ravel() * 32767))
+
+    def test_quantize(self):
+        positions = np.random.uniform(-50.0, 200.0, (1001, 3)).astype('f4')
+        data, scale, offset = moderngl.quantize(positions)
+        self.assertEqual(len(data), 1001 * 6)
+
+        res = self.transform(data, '3n2', 1001)[:, :3] * scale + offset
+        np.testing.assert_allclose(res, positions, atol=np.max(scale) / 32767.0 * 1.01)
+
+        data, scale, offset = moderngl.quantize(positions, dtype='n1')
+        self.assertEqual(len(data), 1001 * 3)
+        res = np.frombuffer(data, 'i1').reshape(1001, 3) / 127.0 * scale + offset
+        np.testing.assert_allclose(res, positions, atol=np.max(scale) / 127.0 * 1.01)
+
+        data, scale, offset = moderngl.quantize(positions, dtype='f2')
+        self.assertEqual((scale, offset), ((1.0, 1.0, 1.0), (0.0, 0.0, 0.0)))
+        np.testing.assert_array_equal(np.frombuffer(data, 'f2'), positions.ravel().astype('f2'))
+
+    def test_quantize_flat(self):
+        data, scale, offset = moderngl.quantize(np.array([[1.0, 2.0], [1.0, 4.0]], 'f4'), components=2)
+        self.assertEqual(scale, (1.0, 1.0))
+        self.assertEqual(offset, (1.0, 3.0))
+        self.assertEqual(np.frombuffer(data, 'i2').tolist(), [0, -32767, 0, 32767])
+
+    def test_errors(self):
+        with self.assertRaises(moderngl.Error):
+            moderngl.encode_normals(self.normals, components=2)
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.encode_normals(self.normals[:, :2].copy())
+
+        with self.assertRaises(moderngl.Error):
+            moderngl.quantize(self.normals, dtype='f4')
+
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in ivec4 in_vert;
+                out ivec4 out_vert;
+
+                void main() {
+                    out_vert = in_vert;
+                }
+            ''',
+            varyings=['out_vert']
+        )
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.vertex_array(prog, [(self.ctx.buffer(reserve=16), '4n10', 'in_vert')])
+
+
+if __name__ == '__main__':
+    unittest.main()
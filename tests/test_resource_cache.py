@@ -0,0 +1,69 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_content_hash(self):
+        self.assertEqual(moderngl.content_hash(b''), 0xEF46DB3751D8E999)
+        self.assertEqual(moderngl.content_hash(b'abc'), 0x44BC2CF5AD770999)
+
+        data = np.arange(1000, dtype='f4')
+        self.assertEqual(moderngl.content_hash(data), moderngl.content_hash(data.tobytes()))
+        self.assertNotEqual(moderngl.content_hash(data), moderngl.content_hash(data, 1))
+        self.assertNotEqual(moderngl.content_hash(data[:-1]), moderngl.content_hash(data))
+
+    def test_buffer(self):
+        cache = self.ctx.resource_cache()
+        data = np.arange(256, dtype='f4')
+
+        buf1 = cache.buffer(data)
+        buf2 = cache.buffer(data.tobytes())
+        buf3 = cache.buffer(data[::-1].copy())
+
+        self.assertIs(buf1, buf2)
+        self.assertIsNot(buf1, buf3)
+        self.assertEqual(buf1.read(), data.tobytes())
+        self.assertEqual(cache.references(buf1), 2)
+        self.assertEqual((cache.hits, cache.misses, cache.bytes_saved), (1, 2, 1024))
+        self.assertEqual((cache.objects, cache.size), (2, 2048))
+
+        cache.release(buf1)
+        self.assertEqual(buf1.read(), data.tobytes())
+        cache.release(buf2)
+        self.assertEqual(cache.references(buf1), 0)
+
+        with self.assertRaises(moderngl.Error):
+            cache.release(buf1)
+
+        cache.clear()
+        self.assertEqual(cache.objects, 0)
+
+    def test_texture(self):
+        cache = self.ctx.resource_cache()
+        pixels = bytes(range(64))
+
+        tex1 = cache.texture((4, 4), 4, pixels)
+        tex2 = cache.texture((4, 4), 4, pixels)
+        tex3 = cache.texture((8, 2), 4, pixels)
+        tex4 = cache.texture((4, 4), 1, pixels, dtype='f4')
+
+        self.assertIs(tex1, tex2)
+        self.assertIsNot(tex1, tex3)
+        self.assertIsNot(tex1, tex4)
+        self.assertEqual(tex1.read(), pixels)
+        self.assertEqual((cache.hits, cache.misses, cache.bytes_saved), (1, 3, 64))
+
+        cache.clear()
+
+
+if __name__ == '__main__':
+    unittest.main()
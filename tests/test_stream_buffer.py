@@ -0,0 +1,86 @@
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def setUp(self):
+        try:
+            self.stream = self.ctx.stream_buffer(64, regions=2)
+        except moderngl.Error as ex:
+            self.skipTest(str(ex))
+
+    def tearDown(self):
+        self.stream.release()
+
+    def test_attributes(self):
+        self.assertIsInstance(self.stream, moderngl.Buffer)
+        self.assertEqual(self.stream.size, 64)
+        self.assertEqual(self.stream.regions, 2)
+        self.assertEqual(self.stream.region_size, 32)
+
+    def test_allocate(self):
+        offset1, view1 = self.stream.allocate(3)
+        view1[:] = b'abc'
+        offset2, view2 = self.stream.allocate(4, alignment=4)
+        view2[:] = b'wxyz'
+        self.assertEqual(offset1, 0)
+        self.assertEqual(offset2, 4)
+        self.assertEqual(len(view2), 4)
+
+        buf = self.ctx.buffer(reserve=8)
+        self.ctx.copy_buffer(buf, self.stream, 8)
+        self.assertEqual(buf.read(3), b'abc')
+        self.assertEqual(buf.read(4, offset=4), b'wxyz')
+
+    def test_allocate_release(self):
+        offset, view = self.stream.allocate(8)
+
+        with self.assertRaises(BufferError):
+            self.stream.release()
+
+        view[:] = b'12345678'
+        view.release()
+
+    def test_advance(self):
+        self.assertEqual(self.stream.allocate(16)[0], 0)
+        self.stream.advance()
+        self.assertEqual(self.stream.allocate(16)[0], 32)
+        self.assertEqual(self.stream.allocate(24)[0], 0)
+        self.stream.advance()
+        self.stream.advance()
+        self.assertEqual(self.stream.allocate(8)[0], 32)
+
+    def test_full(self):
+        self.assertEqual(self.stream.allocate(32)[0], 0)
+        self.assertEqual(self.stream.allocate(32)[0], 32)
+
+        # Both regions were written since the last advance, none of them can be reused yet.
+        with self.assertRaisesRegex(moderngl.Error, 'advance'):
+            self.stream.allocate(1)
+
+        self.stream.advance()
+        self.assertEqual(self.stream.allocate(8)[0], 0)
+
+    def test_allocate_errors(self):
+        with self.assertRaisesRegex(moderngl.Error, 'region'):
+            self.stream.allocate(33)
+
+        with self.assertRaisesRegex(moderngl.Error, 'alignment'):
+            self.stream.allocate(4, alignment=0)
+
+    def test_not_a_stream_buffer(self):
+        buf = self.ctx.buffer(reserve=4)
+        with self.assertRaisesRegex(moderngl.Error, 'stream buffer'):
+            buf.mglo.advance()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,125 @@
+import os
+import tempfile
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+CHUNK = 4096
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        if cls.ctx.version_code < 440:
+            raise unittest.SkipTest('streaming loaders require OpenGL 4.4')
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in float in_value;
+                out float out_value;
+
+                void main() {
+                    out_value = in_value;
+                }
+            ''',
+            varyings=['out_value'],
+        )
+
+        # 10 chunks and a short one at the end.
+        cls.data = np.arange(CHUNK // 4 * 10 + 100, dtype='f4')
+        fd, cls.path = tempfile.mkstemp()
+        with os.fdopen(fd, 'wb') as f:
+            f.write(cls.data.tobytes())
+
+    @classmethod
+    def tearDownClass(cls):
+        os.remove(cls.path)
+
+    def fetch(self, loader, chunk):
+        offset = loader.locate(chunk)
+        self.assertIsNotNone(offset)
+        count = min(CHUNK, loader.source_size - chunk * CHUNK) // 4
+        vao = self.ctx.simple_vertex_array(self.prog, loader.buffer, 'in_value')
+        out = self.ctx.buffer(reserve=count * 4)
+        vao.transform(out, moderngl.POINTS, count, first=offset // 4)
+        result = np.frombuffer(out.read(), 'f4')
+        vao.release()
+        out.release()
+        return result
+
+    def expected(self, chunk):
+        return self.data[chunk * CHUNK // 4:(chunk + 1) * CHUNK // 4]
+
+    def test_file(self):
+        loader = self.ctx.streaming_loader(self.path, CHUNK, CHUNK * 3)
+        self.assertEqual(loader.chunks, 11)
+        self.assertEqual(loader.slots, 3)
+
+        loader.request([0, 1, 2])
+        self.assertEqual(loader.update(wait=True), [0, 1, 2])
+        self.assertEqual([chunk for chunk, _, _ in loader.resident], [0, 1, 2])
+
+        for chunk in range(3):
+            np.testing.assert_array_equal(self.fetch(loader, chunk), self.expected(chunk))
+
+        loader.request([10])
+        self.assertEqual(loader.update(wait=True), [10])
+        self.assertEqual(loader.resident[-1][2], 400)
+        np.testing.assert_array_equal(self.fetch(loader, 10), self.expected(10))
+        loader.release()
+
+    def test_lru_eviction(self):
+        loader = self.ctx.streaming_loader(self.path, CHUNK, CHUNK * 3, threads=1)
+
+        for chunk in range(3):
+            loader.request([chunk])
+            loader.update(wait=True)
+
+        loader.request([0, 5])
+        self.assertEqual(loader.update(wait=True), [5])
+        self.assertEqual([chunk for chunk, _, _ in loader.resident], [0, 2, 5])
+        self.assertIsNone(loader.locate(1))
+        np.testing.assert_array_equal(self.fetch(loader, 5), self.expected(5))
+        np.testing.assert_array_equal(self.fetch(loader, 0), self.expected(0))
+        loader.release()
+
+    def test_over_budget(self):
+        loader = self.ctx.streaming_loader(self.path, CHUNK, CHUNK * 2)
+        loader.request([4, 5, 6])
+        self.assertEqual(loader.update(wait=True), [4, 5])
+        loader.release()
+
+    def test_memmap_read_ahead(self):
+        source = np.memmap(self.path, dtype='f4', mode='r')
+        loader = self.ctx.streaming_loader(source, CHUNK, '1MB', read_ahead=2)
+        self.assertEqual(loader.slots, 11)
+
+        loader.request([3])
+        self.assertEqual(loader.update(wait=True), [3, 4, 5])
+
+        for chunk in range(3, 6):
+            np.testing.assert_array_equal(self.fetch(loader, chunk), self.expected(chunk))
+
+        loader.release()
+        del source
+
+    def test_errors(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.streaming_loader(self.path, CHUNK, CHUNK - 1)
+
+        loader = self.ctx.streaming_loader(b'\0' * 100, 64, 64)
+        with self.assertRaises(moderngl.Error):
+            loader.request([2])
+        loader.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,152 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.fetch_float = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                uniform samplerBuffer lut;
+                uniform int first;
+
+                in float in_dummy;
+                out vec4 out_value;
+
+                void main() {
+                    out_value = texelFetch(lut, first + gl_VertexID) + in_dummy;
+                }
+            ''',
+            varyings=['out_value'],
+        )
+
+        cls.fetch_uint = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                uniform usamplerBuffer lut;
+
+                in float in_dummy;
+                out uint out_value;
+
+                void main() {
+                    out_value = texelFetch(lut, gl_VertexID).r + uint(in_dummy);
+                }
+            ''',
+            varyings=['out_value'],
+        )
+
+        cls.dummy = cls.ctx.buffer(reserve=64 * 4)
+
+    def fetch(self, prog, texture, count, location=0, dtype='f4', components=4):
+        prog['lut'].value = location
+        texture.use(location)
+        vao = self.ctx.simple_vertex_array(prog, self.dummy, 'in_dummy')
+        out = self.ctx.buffer(reserve=count * components * 4)
+        vao.transform(out, moderngl.POINTS, count)
+        result = np.frombuffer(out.read(), dtype).reshape(count, components)
+        vao.release()
+        out.release()
+        return result
+
+    def test_whole_buffer(self):
+        data = np.arange(64, dtype='f4')
+        buf = self.ctx.buffer(data)
+        texture = self.ctx.texture_buffer(buf, '4f')
+
+        self.assertEqual(texture.components, 4)
+        self.assertEqual(texture.dtype, 'f4')
+        self.assertEqual(texture.size, buf.size)
+        self.assertEqual(texture.texels, 16)
+
+        self.fetch_float['first'].value = 0
+        np.testing.assert_array_equal(self.fetch(self.fetch_float, texture, 16), data.reshape(16, 4))
+
+        texture.write(np.full(4, 100.0, 'f4'), offset=32)
+        np.testing.assert_array_equal(self.fetch(self.fetch_float, texture, 4)[2], [100.0] * 4)
+
+        buf.write(np.full(4, -1.0, 'f4'), offset=16)
+        np.testing.assert_array_equal(self.fetch(self.fetch_float, texture, 4)[1], [-1.0] * 4)
+
+        texture.release()
+        buf.release()
+
+    def test_range(self):
+        if self.ctx.version_code < 430:
+            self.skipTest('texture buffer ranges require OpenGL 4.3')
+
+        alignment = self.ctx.info.get('GL_TEXTURE_BUFFER_OFFSET_ALIGNMENT', 256)
+        data = np.arange(alignment // 4 + 32, dtype='u4')
+        buf = self.ctx.buffer(data)
+        texture = self.ctx.texture_buffer(buf, '1u4', offset=alignment, size=64)
+
+        self.assertEqual(texture.offset, alignment)
+        self.assertEqual(texture.texels, 16)
+
+        result = self.fetch(self.fetch_uint, texture, 16, location=3, dtype='u4', components=1)
+        np.testing.assert_array_equal(result.flatten(), data[alignment // 4:alignment // 4 + 16])
+
+        texture.release()
+        buf.release()
+
+    def test_normalized(self):
+        buf = self.ctx.buffer(np.array([0, 255, 51, 102, 255, 0, 0, 255], 'u1'))
+        texture = self.ctx.texture_buffer(buf, '4f1')
+        self.fetch_float['first'].value = 0
+        result = self.fetch(self.fetch_float, texture, 2)
+        np.testing.assert_allclose(result, [[0.0, 1.0, 0.2, 0.4], [1.0, 0.0, 0.0, 1.0]], atol=1e-6)
+        texture.release()
+        buf.release()
+
+    def test_scope(self):
+        buf = self.ctx.buffer(np.arange(16, dtype='f4'))
+        texture = self.ctx.texture_buffer(buf, '4f')
+
+        self.fetch_float['lut'].value = 5
+        self.fetch_float['first'].value = 2
+        vao = self.ctx.simple_vertex_array(self.fetch_float, self.dummy, 'in_dummy')
+        out = self.ctx.buffer(reserve=16)
+
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        scope = self.ctx.scope(fbo, textures=[(texture, 5)])
+        with scope:
+            vao.transform(out, moderngl.POINTS, 1)
+
+        np.testing.assert_array_equal(np.frombuffer(out.read(), 'f4'), [8.0, 9.0, 10.0, 11.0])
+        fbo.release()
+        texture.release()
+        buf.release()
+
+    def test_errors(self):
+        buf = self.ctx.buffer(reserve=1200)
+
+        for fmt in ['3f2', '3u1', '1f8', '2n2', '4f10', '2f 2f', '4f/i', 'x']:
+            with self.subTest(format=fmt):
+                with self.assertRaises(moderngl.Error):
+                    self.ctx.texture_buffer(buf, fmt)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_buffer(buf, '4f', size=24)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture_buffer(buf, '1f', offset=1200)
+
+        texture = self.ctx.texture_buffer(buf, '3f')
+        with self.assertRaises(moderngl.Error):
+            texture.write(b'\0' * 16, offset=1192)
+
+        texture.release()
+        buf.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,222 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+def blocks(width, height, block_size, layers=1):
+    count = ((width + 3) // 4) * ((height + 3) // 4) * layers
+    return np.random.randint(0, 255, count * block_size, dtype='u1').tobytes()
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_round_trip(self):
+        for dtype, components, block_size in [('bc1', 4, 8), ('bc3', 4, 16), ('bc4', 1, 8), ('bc5', 2, 16), ('etc2', 3, 8)]:
+            data = blocks(32, 16, block_size)
+            texture = self.ctx.texture((32, 16), components, data, dtype=dtype)
+            self.assertEqual(texture.dtype, dtype)
+            self.assertEqual(texture.read(), data)
+
+            out = bytearray(len(data) + 8)
+            texture.read_into(out, write_offset=8)
+            self.assertEqual(bytes(out[8:]), data)
+            texture.release()
+
+    def test_partial_blocks(self):
+        data = blocks(6, 5, 16)
+        self.assertEqual(len(data), 4 * 16)
+
+        texture = self.ctx.texture((6, 5), 4, data, dtype='bc3')
+        self.assertEqual(texture.read(), data)
+        texture.release()
+
+    def test_write_viewport(self):
+        texture = self.ctx.texture((16, 16), 4, blocks(16, 16, 8), dtype='bc1')
+
+        data = blocks(8, 4, 8)
+        texture.write(data, (4, 8, 8, 4))
+
+        # The viewport starts at block (1, 2), every row of the image holds 4 blocks.
+        self.assertEqual(texture.read()[4 * 8 * 2 + 8:4 * 8 * 2 + 24], data)
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(blocks(4, 4, 8), (2, 0, 4, 4))
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(blocks(8, 4, 8), (0, 0, 6, 4))
+
+        texture.release()
+
+    def test_write_from_buffer(self):
+        data = blocks(16, 16, 16)
+        texture = self.ctx.texture((16, 16), 2, dtype='bc5')
+        pbo = self.ctx.buffer(data)
+
+        texture.write(pbo)
+        self.assertEqual(texture.read(), data)
+
+        out = self.ctx.buffer(reserve=len(data))
+        texture.read_into(out)
+        self.assertEqual(out.read(), data)
+
+        out.release()
+        pbo.release()
+        texture.release()
+
+    def test_mip_chain(self):
+        chain = [blocks(16 >> level, 16 >> level, 8) for level in range(5)]
+        texture = self.ctx.texture((16, 16), 4, chain[0], dtype='bc1')
+
+        for level in range(1, 5):
+            texture.write(chain[level], level=level)
+
+        for level in range(5):
+            self.assertEqual(texture.read(level=level), chain[level])
+
+        with self.assertRaises(moderngl.Error):
+            texture.write(chain[4], level=5)
+
+        texture.release()
+
+        # Skipping levels would leave the texture mipmap incomplete.
+        texture = self.ctx.texture((16, 16), 4, chain[0], dtype='bc1')
+        with self.assertRaises(moderngl.Error):
+            texture.write(chain[3], level=3)
+
+        texture.release()
+
+    def test_sampling(self):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec2 in_vert;
+
+                void main() {
+                    gl_Position = vec4(in_vert, 0.0, 1.0);
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                uniform sampler2D tex;
+                out vec4 color;
+
+                void main() {
+                    color = texelFetch(tex, ivec2(gl_FragCoord.xy), 0);
+                }
+            ''',
+        )
+
+        # Both endpoints of the block are pure red in RGB565.
+        texture = self.ctx.texture((4, 4), 3, struct.pack('<HHI', 0xF800, 0xF800, 0), dtype='bc1')
+        fbo = self.ctx.simple_framebuffer((4, 4))
+        vbo = self.ctx.buffer(np.array([-1.0, -1.0, 3.0, -1.0, -1.0, 3.0], dtype='f4'))
+        vao = self.ctx.simple_vertex_array(prog, vbo, 'in_vert')
+
+        fbo.use()
+        texture.use()
+        vao.render(moderngl.TRIANGLES, 3)
+
+        pixels = np.frombuffer(fbo.read(components=4), 'u1').reshape(16, 4)
+        np.testing.assert_array_equal(pixels, [[255, 0, 0, 255]] * 16)
+
+        vao.release()
+        vbo.release()
+        fbo.release()
+        texture.release()
+        prog.release()
+
+    def test_texture_array(self):
+        data = blocks(8, 8, 16, layers=3)
+        texture = self.ctx.texture_array((8, 8, 3), 4, data, dtype='bc3')
+        self.assertEqual(texture.read(), data)
+
+        layer = blocks(8, 8, 16)
+        texture.write(layer, (0, 0, 1, 8, 8, 1))
+        self.assertEqual(texture.read()[len(layer):len(layer) * 2], layer)
+
+        with self.assertRaises(moderngl.Error):
+            texture.stream(data, 1)
+
+        texture.release()
+
+    def test_texture_cube(self):
+        faces = [blocks(8, 8, 8) for _ in range(6)]
+        texture = self.ctx.texture_cube((8, 8), 1, b''.join(faces), dtype='bc4')
+
+        for face in range(6):
+            self.assertEqual(texture.read(face), faces[face])
+
+        face = blocks(8, 8, 8)
+        texture.write(2, face)
+        self.assertEqual(texture.read(2), face)
+        texture.release()
+
+    def test_texture_cube_mip_chain(self):
+        chain = [blocks(16 >> level, 16 >> level, 16) * 6 for level in range(5)]
+        texture = self.ctx.texture_cube((16, 16), 4, chain[0], dtype='etc2')
+
+        texture.write_all(b''.join(chain[1:]), 1, levels=4)
+        self.assertEqual(texture.read_all(levels=5), b''.join(chain))
+        self.assertEqual(texture.read_all(3), chain[3])
+        texture.release()
+
+        texture = self.ctx.texture_cube((16, 16), 4, chain[0], dtype='etc2')
+        with self.assertRaises(moderngl.Error):
+            texture.write_all(chain[3], 3)
+        texture.write_all(chain[1], 1)
+        self.assertEqual(texture.read_all(levels=2), chain[0] + chain[1])
+        texture.release()
+
+    def test_errors(self):
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((8, 8), 4, b'\x00' * 31, dtype='bc1')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((8, 8), 2, dtype='bc1')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((8, 8), 4, samples=4, dtype='bc3')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture((8, 8), 4, dtype='bc9')
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.texture3d((8, 8, 8), 4, dtype='bc1')
+
+    def test_build_mipmaps(self):
+        texture = self.ctx.texture((8, 8), 4, blocks(8, 8, 8), dtype='bc1')
+        with self.assertRaisesRegex(moderngl.Error, 'compressed textures cannot generate mipmaps'):
+            texture.build_mipmaps()
+        texture.release()
+
+        texture = self.ctx.texture_cube((8, 8), 4, blocks(8, 8, 8) * 6, dtype='bc1')
+        with self.assertRaisesRegex(moderngl.Error, 'compressed textures cannot generate mipmaps'):
+            texture.build_mipmaps()
+        texture.release()
+
+    def test_read_into_negative_offset(self):
+        texture = self.ctx.texture((8, 8), 4, blocks(8, 8, 8), dtype='bc1')
+
+        with self.assertRaisesRegex(moderngl.Error, 'write_offset'):
+            texture.read_into(bytearray(64), write_offset=-8)
+
+        out = self.ctx.buffer(reserve=64)
+        with self.assertRaisesRegex(moderngl.Error, 'write_offset'):
+            texture.read_into(out, write_offset=-8)
+
+        out.release()
+        texture.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
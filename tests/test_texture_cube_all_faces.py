@@ -0,0 +1,89 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_write_all(self):
+        faces = np.random.randint(0, 255, (6, 16, 16, 4), dtype='u1')
+        texture = self.ctx.texture_cube((16, 16), 4)
+        texture.write_all(faces)
+
+        for face in range(6):
+            self.assertEqual(texture.read(face), faces[face].tobytes())
+
+        self.assertEqual(texture.read_all(), faces.tobytes())
+        texture.release()
+
+    def test_read_all_into(self):
+        faces = np.random.rand(6, 8, 8, 3).astype('f4')
+        texture = self.ctx.texture_cube((8, 8), 3, faces.tobytes(), dtype='f4')
+
+        out = bytearray(faces.nbytes + 16)
+        self.assertIsNone(texture.read_all(out=out, write_offset=16))
+        self.assertEqual(bytes(out[16:]), faces.tobytes())
+
+        pbo = self.ctx.buffer(reserve=faces.nbytes)
+        texture.read_all(out=pbo)
+        self.assertEqual(pbo.read(), faces.tobytes())
+
+        texture.write_all(pbo)
+        self.assertEqual(texture.read_all(), faces.tobytes())
+
+        pbo.release()
+        texture.release()
+
+    def test_alignment(self):
+        faces = np.random.randint(0, 255, (6, 5, 5, 3), dtype='u1')
+        padded = np.zeros((6, 5, 16), dtype='u1')
+        padded[:, :, :15] = faces.reshape(6, 5, 15)
+
+        texture = self.ctx.texture_cube((5, 5), 3)
+        texture.write_all(padded, alignment=8)
+        self.assertEqual(texture.read_all(), faces.tobytes())
+        self.assertEqual(texture.read_all(alignment=8), padded.tobytes())
+        texture.release()
+
+    def test_mip_chain(self):
+        texture = self.ctx.texture_cube((16, 16), 1)
+        texture.build_mipmaps()
+
+        chain = [np.full((6, 16 >> level, 16 >> level), level * 10, dtype='u1') for level in range(5)]
+        texture.write_all(b''.join(level.tobytes() for level in chain), levels=5)
+
+        self.assertEqual(texture.read_all(2), chain[2].tobytes())
+        self.assertEqual(texture.read_all(1, levels=4), b''.join(level.tobytes() for level in chain[1:]))
+
+        texture.write_all(np.zeros((6, 2, 2), dtype='u1'), 3)
+        self.assertEqual(texture.read_all(3), bytes(24))
+
+        with self.assertRaises(moderngl.Error):
+            texture.read_all(5)
+
+        texture.release()
+
+    def test_errors(self):
+        texture = self.ctx.texture_cube((4, 4), 4)
+
+        with self.assertRaises(moderngl.Error):
+            texture.write_all(bytes(4 * 4 * 4 * 5))
+
+        with self.assertRaises(moderngl.Error):
+            texture.read_all(1)
+
+        with self.assertRaises(moderngl.Error):
+            texture.read_all(out=bytearray(10))
+
+        texture.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
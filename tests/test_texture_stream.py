@@ -0,0 +1,98 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.volume = np.random.randint(0, 255, (37, 16, 8, 2), dtype='u1')
+
+    def test_texture_3d(self):
+        texture = self.ctx.texture3d((8, 16, 37), 2)
+        stream = texture.stream(self.volume, 5)
+
+        self.assertEqual(stream.slices, 37)
+        self.assertEqual(stream.slices_per_batch, 5)
+
+        uploaded = stream.update(wait=True)
+
+        self.assertTrue(stream.done)
+        self.assertEqual(stream.progress, 1.0)
+        self.assertEqual(stream.valid, b'\x01' * 37)
+        self.assertEqual(sorted(uploaded), [(first, min(5, 37 - first)) for first in range(0, 37, 5)])
+        self.assertEqual(texture.read(), self.volume.tobytes())
+
+        stream.release()
+        texture.release()
+
+    def test_texture_array(self):
+        texture = self.ctx.texture_array((8, 16, 37), 2)
+        stream = texture.stream(self.volume, 4, buffers=3)
+
+        while not stream.done:
+            stream.update()
+            valid = np.frombuffer(stream.valid, 'u1')
+            self.assertEqual(int(valid.sum()), stream.loaded)
+
+        self.assertEqual(texture.read(), self.volume.tobytes())
+
+        stream.release()
+        texture.release()
+
+    def test_callable(self):
+        calls = []
+
+        def source(first, last):
+            calls.append((first, last))
+            return self.volume[first:last]
+
+        texture = self.ctx.texture3d((8, 16, 37), 2)
+        stream = texture.stream(source, 16)
+        stream.update(wait=True)
+
+        self.assertEqual(calls, [(0, 16), (16, 32), (32, 37)])
+        self.assertEqual(texture.read(), self.volume.tobytes())
+
+        stream.release()
+        texture.release()
+
+    def test_partial(self):
+        texture = self.ctx.texture3d((8, 16, 37), 2)
+        stream = texture.stream(self.volume, 8, buffers=1)
+
+        while not stream.update():
+            pass
+
+        self.assertLess(stream.loaded, 37)
+        self.assertEqual(stream.valid[:8], b'\x01' * 8)
+        self.assertEqual(texture.read()[:self.volume[:8].nbytes], self.volume[:8].tobytes())
+
+        stream.release()
+        texture.release()
+
+    def test_errors(self):
+        texture = self.ctx.texture3d((8, 16, 37), 2)
+
+        with self.assertRaises(moderngl.Error):
+            texture.stream(self.volume[:36], 4)
+
+        with self.assertRaises(moderngl.Error):
+            texture.stream(self.volume, 0)
+
+        stream = texture.stream(lambda first, last: b'\x00', 4)
+
+        with self.assertRaises(moderngl.Error):
+            stream.update(wait=True)
+
+        stream.release()
+        texture.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
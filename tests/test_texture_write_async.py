@@ -0,0 +1,63 @@
+import struct
+import unittest
+
+import moderngl
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+    def test_texture(self):
+        tex = self.ctx.texture((4, 4), 3)
+        data = bytes(range(48))
+        tex.write(data, async_=True)
+        self.assertEqual(tex.read(), data)
+
+    def test_texture_viewport(self):
+        tex = self.ctx.texture((4, 4), 1, bytes(16))
+        tex.write(b'\x01\x02\x03\x04', (1, 1, 2, 2), async_=True)
+        self.assertEqual(tex.read(), b'\x00' * 5 + b'\x01\x02\x00\x00\x03\x04' + b'\x00' * 5)
+
+    def test_texture_float(self):
+        tex = self.ctx.texture((2, 2), 1, dtype='f4')
+        data = struct.pack('4f', 1.0, 2.0, 3.0, 4.0)
+        tex.write(bytearray(data), async_=True)
+        self.assertEqual(tex.read(), data)
+
+    def test_many_writes(self):
+        tex = self.ctx.texture((64, 64), 4)
+        for i in range(64):
+            tex.write(bytes([i]) * 64 * 64 * 4, async_=True)
+        self.assertEqual(tex.read(), b'\x3f' * 64 * 64 * 4)
+
+    def test_texture_array(self):
+        tex = self.ctx.texture_array((2, 2, 2), 1)
+        data = bytes(range(8))
+        tex.write(data, async_=True)
+        self.assertEqual(tex.read(), data)
+
+    def test_texture_3d(self):
+        tex = self.ctx.texture3d((2, 2, 2), 1)
+        data = bytes(range(8))
+        tex.write(data, async_=True)
+        self.assertEqual(tex.read(), data)
+
+    def test_texture_cube(self):
+        tex = self.ctx.texture_cube((2, 2), 1)
+        data = bytes(range(4))
+        tex.write(3, data, async_=True)
+        self.assertEqual(tex.read(3), data)
+
+    def test_size_mismatch(self):
+        tex = self.ctx.texture((4, 4), 3)
+        with self.assertRaisesRegex(moderngl.Error, 'size mismatch'):
+            tex.write(b'abc', async_=True)
+
+
+if __name__ == '__main__':
+    unittest.main()
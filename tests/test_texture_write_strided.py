@@ -0,0 +1,77 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+        cls.image = np.random.randint(0, 255, (256, 256, 4), dtype='u1')
+        cls.volume = np.random.rand(16, 32, 32, 2).astype('f4')
+
+    def check_texture(self, components, tile, dtype='f1'):
+        texture = self.ctx.texture((tile.shape[1], tile.shape[0]), components, dtype=dtype)
+        texture.write(tile)
+        np.testing.assert_array_equal(np.frombuffer(texture.read(), tile.dtype), tile.ravel())
+        texture.release()
+
+    def test_tile(self):
+        self.check_texture(4, self.image[32:96, 64:192])
+        self.check_texture(4, self.image[100:101, 8:40])
+        self.check_texture(4, self.image[:, 13:14])
+
+    def test_gathered(self):
+        # Strides that are not whole rows of pixels fall back to a packed copy.
+        self.check_texture(3, self.image[16:48, 16:48, :3])
+        self.check_texture(4, self.image[::-1, :64])
+        self.check_texture(4, self.image[::2, ::2])
+        self.check_texture(1, self.image[:32, :32, 0])
+
+    def test_viewport(self):
+        texture = self.ctx.texture((256, 256), 4, self.image.tobytes())
+        tile = self.image[64:128, 32:64][::-1].copy()
+        texture.write(self.image[::-1][128:192, 32:64], viewport=(32, 64, 32, 64))
+        result = np.frombuffer(texture.read(), 'u1').reshape(256, 256, 4)
+        np.testing.assert_array_equal(result[64:128, 32:64], tile)
+        np.testing.assert_array_equal(result[:64], self.image[:64])
+        texture.release()
+
+    def test_size_mismatch(self):
+        texture = self.ctx.texture((16, 16), 4)
+        with self.assertRaises(moderngl.Error):
+            texture.write(self.image[:16, :15])
+        texture.release()
+
+    def test_texture_3d(self):
+        tile = self.volume[2:10, 4:20, 8:24]
+        texture = self.ctx.texture3d((16, 16, 8), 2, dtype='f4')
+        texture.write(tile)
+        np.testing.assert_array_equal(np.frombuffer(texture.read(), 'f4'), tile.ravel())
+        texture.write(self.volume[::2, :16, :16])
+        np.testing.assert_array_equal(np.frombuffer(texture.read(), 'f4'), self.volume[::2, :16, :16].ravel())
+        texture.release()
+
+    def test_texture_array(self):
+        tile = self.volume[:4, 16:, 16:]
+        texture = self.ctx.texture_array((16, 16, 4), 2, dtype='f4')
+        texture.write(tile)
+        np.testing.assert_array_equal(np.frombuffer(texture.read(), 'f4'), tile.ravel())
+        texture.release()
+
+    def test_texture_cube(self):
+        texture = self.ctx.texture_cube((32, 32), 4)
+        for face in range(6):
+            texture.write(face, self.image[face * 32:face * 32 + 32, 100:132])
+        for face in range(6):
+            result = np.frombuffer(texture.read(face), 'u1')
+            np.testing.assert_array_equal(result, self.image[face * 32:face * 32 + 32, 100:132].ravel())
+        texture.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
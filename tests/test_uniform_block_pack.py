@@ -0,0 +1,143 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in float in_index;
+                out vec4 out_value;
+
+                layout (std140) uniform Material {
+                    float roughness;
+                    vec3 tint;
+                    int mode;
+                    bool enabled;
+                    vec2 offsets[3];
+                    mat3 normal_matrix;
+                    layout (row_major) mat2 uv_matrix;
+                } material;
+
+                void main() {
+                    int i = int(in_index);
+                    if (i == 0) {
+                        out_value = vec4(material.tint, material.roughness);
+                    } else if (i == 1) {
+                        out_value = vec4(float(material.mode), material.enabled ? 1.0 : 0.0, material.offsets[2]);
+                    } else if (i == 2) {
+                        out_value = vec4(material.normal_matrix[1], material.normal_matrix[2].z);
+                    } else {
+                        out_value = vec4(material.uv_matrix[0], material.uv_matrix[1]);
+                    }
+                }
+            ''',
+            varyings=['out_value'],
+        )
+        cls.prog['Material'].binding = 5
+
+        cls.vbo = cls.ctx.buffer(np.arange(4, dtype='f4'))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'in_index')
+
+    def transform(self, block):
+        ubo = self.ctx.buffer(block)
+        ubo.bind_to_uniform_block(5)
+        out = self.ctx.buffer(reserve=64)
+        self.vao.transform(out, moderngl.POINTS)
+        result = np.frombuffer(out.read(), 'f4').reshape(4, 4)
+        ubo.release()
+        out.release()
+        return result
+
+    def values(self):
+        return {
+            'roughness': 0.25,
+            'tint': (1.0, 0.5, 0.125),
+            'mode': 7,
+            'enabled': True,
+            'offsets': [(1.0, 2.0), (3.0, 4.0), (5.0, 6.0)],
+            'normal_matrix': np.arange(9, dtype='f8'),
+            'uv_matrix': np.array([10, 20, 30, 40], dtype='i8'),
+        }
+
+    def test_layout(self):
+        layout = self.prog['Material'].layout
+        self.assertEqual(set(layout), {'roughness', 'tint', 'mode', 'enabled', 'offsets', 'normal_matrix', 'uv_matrix'})
+
+        # std140 offsets
+        self.assertEqual(layout['roughness'][0], 0)
+        self.assertEqual(layout['tint'][0], 16)
+        self.assertEqual(layout['offsets'][:3], (48, 3, 16))
+        self.assertEqual(layout['normal_matrix'][3:7], (16, 3, 3, 'f'))
+        self.assertTrue(layout['uv_matrix'][7])
+
+    def test_pack_bytes(self):
+        block = self.prog['Material'].pack(self.values())
+        self.assertEqual(len(block), self.prog['Material'].size)
+
+        result = self.transform(block)
+        np.testing.assert_allclose(result[0], [1.0, 0.5, 0.125, 0.25])
+        np.testing.assert_allclose(result[1], [7.0, 1.0, 5.0, 6.0])
+        np.testing.assert_allclose(result[2], [3.0, 4.0, 5.0, 8.0])
+        np.testing.assert_allclose(result[3], [10.0, 20.0, 30.0, 40.0])
+
+    def test_pack_structured(self):
+        dtype = np.dtype([('roughness', 'f4'), ('tint', 'f4', 3), ('mode', 'i4')])
+        values = np.array([(0.5, (0.25, 0.75, 1.0), 3)], dtype=dtype)
+
+        block = self.prog['Material'].pack(values)
+        result = self.transform(block)
+        np.testing.assert_allclose(result[0], [0.25, 0.75, 1.0, 0.5])
+        self.assertEqual(result[1][0], 3.0)
+
+    def test_pack_into_buffer(self):
+        size = self.prog['Material'].size
+        ubo = self.ctx.buffer(reserve=size + 256)
+
+        self.prog['Material'].pack(self.values(), out=ubo, offset=256)
+        self.prog['Material'].pack({'roughness': 0.75}, out=ubo, offset=256)
+
+        self.assertEqual(ubo.read(4, offset=256), struct.pack('f', 0.75))
+        self.assertEqual(ubo.read(12, offset=272), struct.pack('3f', 1.0, 0.5, 0.125))
+        ubo.release()
+
+    def test_pack_into_bytearray(self):
+        size = self.prog['Material'].size
+        out = bytearray(size + 16)
+        self.prog['Material'].pack({'mode': -2, 'tint': [1, 2, 3]}, out=out, offset=16)
+        self.assertEqual(bytes(out[32:44]), struct.pack('3f', 1.0, 2.0, 3.0))
+        mode_offset = self.prog['Material'].layout['mode'][0]
+        self.assertEqual(bytes(out[16 + mode_offset:20 + mode_offset]), struct.pack('i', -2))
+
+    def test_pack_errors(self):
+        block = self.prog['Material']
+
+        with self.assertRaises(moderngl.Error):
+            block.pack({'missing': 1.0})
+
+        with self.assertRaises(moderngl.Error):
+            block.pack({'tint': (1.0, 2.0)})
+
+        with self.assertRaises(moderngl.Error):
+            block.pack({'tint': (1.0, 2.0, 3.0, 4.0)})
+
+        with self.assertRaises(moderngl.Error):
+            block.pack({'roughness': 'abc'})
+
+        with self.assertRaises(moderngl.Error):
+            block.pack({'roughness': 1.0}, out=bytearray(4))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,121 @@
+import struct
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec2 in_vert;
+
+                layout (std140) uniform Draw {
+                    vec4 offset;
+                    vec4 color;
+                };
+
+                out vec4 v_color;
+
+                void main() {
+                    gl_Position = vec4(in_vert + offset.xy, 0.0, 1.0);
+                    v_color = color;
+                }
+            ''',
+            fragment_shader='''
+                #version 330
+
+                in vec4 v_color;
+                out vec4 f_color;
+
+                void main() {
+                    f_color = v_color;
+                }
+            ''',
+        )
+        cls.prog['Draw'].binding = 3
+
+        # A quad covering the left-most pixel of a 16 pixel wide framebuffer.
+        cls.vbo = cls.ctx.buffer(np.array([
+            -1.0, -1.0, -0.875, -1.0, -1.0, 1.0,
+            -1.0, 1.0, -0.875, -1.0, -0.875, 1.0,
+        ], 'f4'))
+        cls.vao = cls.ctx.simple_vertex_array(cls.prog, cls.vbo, 'in_vert')
+
+    def setUp(self):
+        try:
+            self.ring = self.ctx.uniform_ring(0x10000)
+        except moderngl.Error:
+            self.skipTest('stream buffers are not supported')
+
+    def tearDown(self):
+        self.ring.release()
+
+    def test_alignment(self):
+        self.assertEqual(self.ring.alignment, self.ctx.info['GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT'])
+
+        offsets = [self.ring.push(struct.pack('8f', *range(8)))[1] for i in range(4)]
+        for offset in offsets:
+            self.assertEqual(offset % self.ring.alignment, 0)
+
+        self.assertEqual(len(set(offsets)), 4)
+
+    def test_render_offsets(self):
+        fbo = self.ctx.simple_framebuffer((16, 1), dtype='f4')
+        fbo.use()
+        fbo.clear()
+
+        for i in range(16):
+            block = self.ring.push(struct.pack('8f', i * 0.125, 0.0, 0.0, 0.0, i / 16.0, 1.0 - i / 16.0, 0.5, 1.0))
+            self.vao.render(uniform_block_offsets={3: block})
+
+        self.ring.advance()
+
+        pixels = np.frombuffer(fbo.read(components=4, dtype='f4'), 'f4').reshape(16, 4)
+        expected = np.array([(i / 16.0, 1.0 - i / 16.0, 0.5, 1.0) for i in range(16)], 'f4')
+        np.testing.assert_allclose(pixels, expected, atol=1e-6)
+        fbo.release()
+
+    def test_render_buffer_range(self):
+        alignment = self.ctx.info['GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT']
+        alignment = (32 + alignment - 1) // alignment * alignment
+        buf = self.ctx.buffer(reserve=alignment * 2)
+        buf.write(struct.pack('8f', 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0), offset=0)
+        buf.write(struct.pack('8f', 0.0, 0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 1.0), offset=alignment)
+
+        fbo = self.ctx.simple_framebuffer((16, 1), dtype='f4')
+        fbo.use()
+
+        self.vao.render(uniform_block_offsets={3: (buf, alignment)})
+        self.assertEqual(fbo.read(components=4, dtype='f4')[:16], struct.pack('4f', 0.0, 1.0, 0.0, 1.0))
+
+        self.vao.render(uniform_block_offsets={3: (buf, 0, 32)})
+        self.assertEqual(fbo.read(components=4, dtype='f4')[:16], struct.pack('4f', 1.0, 0.0, 0.0, 1.0))
+
+        fbo.release()
+        buf.release()
+
+    def test_render_errors(self):
+        buf = self.ctx.buffer(reserve=64)
+
+        with self.assertRaises(moderngl.Error):
+            self.vao.render(uniform_block_offsets={3: (buf, 32, 64)})
+
+        if self.ring.alignment > 1:
+            with self.assertRaises(moderngl.Error):
+                self.vao.render(uniform_block_offsets={3: (buf, 1, 32)})
+
+        buf.release()
+
+
+if __name__ == '__main__':
+    unittest.main()
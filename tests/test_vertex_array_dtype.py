@@ -0,0 +1,139 @@
+import unittest
+
+import moderngl
+import numpy as np
+
+from common import get_context
+
+
+class TestCase(unittest.TestCase):
+
+    @classmethod
+    def setUpClass(cls):
+        cls.ctx = get_context()
+
+        cls.prog = cls.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec3 in_pos;
+                in vec4 in_color;
+                in ivec2 in_id;
+                in vec2 in_normal;
+
+                out vec4 out_a;
+                out vec4 out_b;
+                out vec2 out_c;
+
+                void main() {
+                    out_a = vec4(in_pos, float(in_id.x + in_id.y));
+                    out_b = in_color;
+                    out_c = in_normal;
+                }
+            ''',
+            varyings=['out_a', 'out_b', 'out_c'],
+        )
+
+        cls.dtype = np.dtype([
+            ('in_pos', 'f4', 3),
+            ('weight', 'f8'),
+            ('in_color', 'u1', 4),
+            ('in_id', 'i4', 2),
+            ('in_normal', 'i2', 2),
+        ], align=True)
+
+        cls.vertices = np.zeros(3, dtype=cls.dtype)
+        cls.vertices['in_pos'] = [(1, 2, 3), (4, 5, 6), (7, 8, 9)]
+        cls.vertices['weight'] = 0.5
+        cls.vertices['in_color'] = [(255, 0, 51, 102), (0, 255, 0, 255), (0, 0, 255, 0)]
+        cls.vertices['in_id'] = [(1, 2), (10, 20), (100, 200)]
+        cls.vertices['in_normal'] = [(32767, -32767), (0, 32767), (-32767, 0)]
+
+    def transform(self, vao, count=3):
+        out = self.ctx.buffer(reserve=count * 40)
+        vao.transform(out, moderngl.POINTS, count)
+        result = np.frombuffer(out.read(), 'f4').reshape(count, 10)
+        out.release()
+        return result
+
+    def check(self, result):
+        np.testing.assert_array_equal(result[:, :3], self.vertices['in_pos'])
+        np.testing.assert_array_equal(result[:, 3], [3, 30, 300])
+        np.testing.assert_allclose(result[:, 4:8], self.vertices['in_color'] / 255.0, atol=1e-6)
+        np.testing.assert_allclose(result[:, 8:10], [(1, -1), (0, 1), (-1, 0)], atol=1e-6)
+
+    def test_dtype(self):
+        vbo = self.ctx.buffer(self.vertices)
+        vao = self.ctx.vertex_array(self.prog, [(vbo, self.dtype)])
+        self.check(self.transform(vao))
+        vao.release()
+        vbo.release()
+
+    def test_array(self):
+        vbo = self.ctx.buffer(self.vertices)
+        vao = self.ctx.simple_vertex_array(self.prog, vbo, self.vertices)
+        self.check(self.transform(vao))
+        vao.release()
+        vbo.release()
+
+    def test_selected_fields(self):
+        prog = self.ctx.program(
+            vertex_shader='''
+                #version 330
+
+                in vec3 in_pos;
+                in vec4 in_color;
+                out vec4 out_a;
+
+                void main() {
+                    out_a = vec4(in_pos, 1.0) + in_color;
+                }
+            ''',
+            varyings=['out_a'],
+        )
+
+        vbo = self.ctx.buffer(self.vertices)
+        vao = self.ctx.vertex_array(prog, [(vbo, self.dtype, 'in_pos')])
+        out = self.ctx.buffer(reserve=48)
+        vao.transform(out, moderngl.POINTS)
+        result = np.frombuffer(out.read(), 'f4').reshape(3, 4)
+        np.testing.assert_array_equal(result[:, :3], self.vertices['in_pos'])
+        vao.release()
+        out.release()
+        vbo.release()
+
+    def test_errors(self):
+        vbo = self.ctx.buffer(self.vertices)
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.vertex_array(self.prog, [(vbo, np.dtype('f4'))])
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.vertex_array(self.prog, [(vbo, np.dtype([('other', 'f4')]))])
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.vertex_array(self.prog, [(vbo, self.dtype, 'missing')])
+
+        # No normalized format for 32-bit integers into float attributes.
+        with self.assertRaises(moderngl.Error):
+            self.ctx.vertex_array(self.prog, [(vbo, np.dtype([('in_pos', 'i4', 3)]))])
+
+        # Bools would be normalized to 1/255 in float attributes.
+        with self.assertRaises(moderngl.Error):
+            self.ctx.vertex_array(self.prog, [(vbo, np.dtype([('in_pos', '?', 3)]))])
+
+        # Integer attributes take bools as u1.
+        self.ctx.vertex_array(self.prog, [(vbo, np.dtype([('in_id', '?', 2)]))]).release()
+
+        # Float data cannot feed integer attributes.
+        with self.assertRaises(moderngl.Error):
+            self.ctx.vertex_array(self.prog, [(vbo, np.dtype([('in_id', 'f4', 2)]))])
+
+        with self.assertRaises(moderngl.Error):
+            self.ctx.vertex_array(self.prog, [(vbo, np.dtype([('in_pos', '>f4', 3)]))])
+
+        vbo.release()
+
+
+if __name__ == '__main__':
+    unittest.main()